@@ -85,3 +85,22 @@ function(create_executable TARGET_NAME TARGET_SRC_DIR)
     install(FILES ${TARGET_HEADERS} DESTINATION ${GLOBAL_INCLUDE_DIR})
 
 endfunction()
+
+# Function to create a test program registered in CTest (the program returns a non-zero status on failure)
+function(create_test TARGET_NAME TARGET_SOURCE)
+    add_executable(${TARGET_NAME} ${TARGET_SOURCE})
+
+    # Include directories (test tools)
+    target_include_directories(${TARGET_NAME} PRIVATE ${CMAKE_SOURCE_DIR}/tests)
+
+    # Compile options
+    target_compile_options(${TARGET_NAME} PRIVATE
+        $<$<CONFIG:DEBUG>:-g -O0 -std=c++17>
+        $<$<CONFIG:RELEASE>:-O3 -std=c++17>
+    )
+
+    # Link the tested components (given after the source file, in link order)
+    target_link_libraries(${TARGET_NAME} ${ARGN})
+
+    add_test(NAME ${TARGET_NAME} COMMAND ${TARGET_NAME})
+endfunction()
@@ -14,4 +14,7 @@ list(APPEND EXTERNAL_LIBS
     # ${CMAKE_SOURCE_DIR}/externals/lastus/lib/libmed.so.11
     # ${CMAKE_SOURCE_DIR}/externals/lastus/lib/libmedC.so.11
     # Add more library files as needed
-)
\ No newline at end of file
+)
+# Thread support used by the thread pool
+find_package(Threads REQUIRED)
+list(APPEND EXTERNAL_LIBS Threads::Threads)
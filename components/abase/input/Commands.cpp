@@ -13,16 +13,26 @@ bool BaseCommand::is_same_keyword(const std::string& a_key) {
     // case for empty string
     if (a_key.empty()) return false;
 
-    std::string lower_key = str::lowercase(a_key);
+    // case-insensitive comparison of the first characters of the word with a key
+    auto same_prefix = [&a_key](const std::string& key, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (std::tolower(static_cast<unsigned char>(a_key[i])) != key[i]) return false;
+        }
+        return true;
+    };
+
     for (const auto& translation : translations) {
         const auto& keys = translation.second;
         if (keys.empty()) continue;
-        if (keys.size() == 1 && keys[0] == lower_key) return true;
+        if (keys.size() == 1) {
+            if (a_key.size() == keys[0].size() && same_prefix(keys[0], a_key.size())) return true;
+            continue;
+        }
 
-        if (lower_key.size() < keys[0].size()) continue;
+        if (a_key.size() < keys[0].size()) continue;
 
-        std::size_t min_sz = std::min(keys[1].size(), lower_key.size());
-        if (lower_key.substr(0, min_sz) == keys[1].substr(0, min_sz)) return true;
+        std::size_t min_sz = std::min(keys[1].size(), a_key.size());
+        if (same_prefix(keys[1], min_sz)) return true;
     }
     return false;
 }
@@ -44,17 +54,26 @@ std::vector<std::string> CompositeCommand::get_children_names() const {
 }
 
 std::size_t CompositeCommand::children_process(FileReader& reader, const CommandsCollector& collector) {
-    std::size_t status = 0;
-    while(status == 0 && reader.get_word().size() > 0) {
-        status = 1;
-        for (auto& child : _children) {
-            status *= child->read_input(reader, collector);
-        }
+    std::uint32_t next = 0;
+    std::string word = reader.get_word();
+    while (word.size() > 0) {
+        // first matching child after the last one read, then restart from the first child
+        std::uint32_t rank = _children_keywords.find(word, next);
+        if (rank == KeywordTrie::NO_RANK && next > 0) rank = _children_keywords.find(word);
+        if (rank == KeywordTrie::NO_RANK) return 1;
+
+        _children[rank]->read_input(reader, collector);
+        next = rank + 1;
+        word = reader.get_word();
     }
-    return status;
+    return 0;
 }
 
 void CompositeCommand::addChild(std::shared_ptr<BaseCommand> child) {
+    std::uint32_t rank = static_cast<std::uint32_t>(_children.size());
+    for (const auto& translation : child->get_translations()) {
+        _children_keywords.insert(translation.second, rank);
+    }
     _children.push_back(child);
 }
 
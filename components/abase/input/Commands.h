@@ -1,11 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "FileReader.h"
+#include "KeywordTrie.h"
+#include "RangeList.h"
+#include "Span.h"
 
 namespace abase {
 
@@ -103,6 +107,11 @@ namespace abase {
             void set_translation(const std::string& lang, const std::vector<std::string>& translation) {
                 translations[lang] = translation;
             }
+            /// @brief Return the translations of the command
+            /// @return keys of the command for each language
+            const std::unordered_map<std::string, std::vector<std::string>>& get_translations() const {
+                return translations;
+            }
 
             /// @brief Add a child command to the current one (pure virtual)
             /// @param child the sub command to add
@@ -150,6 +159,18 @@ namespace abase {
             /// @brief Return double values of the command (pure virtual)
             /// @param value returned values
             virtual void get_values(std::vector<double>& values) const { if (_read_status) values.clear(); }
+            /// @brief Return ranges of unsigned values of the command (pure virtual)
+            /// @param value returned values
+            virtual void get_values(RangeList& values) const { if (_read_status) values.clear(); }
+            /// @brief Return a view on the size_t values of the command (pure virtual)
+            /// @param value returned view (valid until the next reading of the command)
+            virtual void get_values(Span<const std::size_t>& values) const { if (_read_status) values = {}; }
+            /// @brief Return a view on the integer values of the command (pure virtual)
+            /// @param value returned view (valid until the next reading of the command)
+            virtual void get_values(Span<const int>& values) const { if (_read_status) values = {}; }
+            /// @brief Return a view on the double values of the command (pure virtual)
+            /// @param value returned view (valid until the next reading of the command)
+            virtual void get_values(Span<const double>& values) const { if (_read_status) values = {}; }
 
     };
 
@@ -159,8 +180,12 @@ namespace abase {
         protected:
             /// @brief List of subcommands associate to the current command
             std::vector<std::shared_ptr<BaseCommand>> _children;
+            /// @brief Keywords of the children, ranked by their position in `_children`
+            KeywordTrie _children_keywords;
 
-            /// @brief Read input process for all children
+            /// @brief Read input process for all children. The child read at each word is found from its keyword:
+            /// children are scanned in their order (from the one following the last child read), as a sequence of
+            /// calls of `read_input` on all children would do.
             virtual std::size_t children_process(FileReader& reader, const CommandsCollector& collector);
 
             /// @brief clear read data if all children
@@ -170,7 +195,7 @@ namespace abase {
             CompositeCommand(const std::string& type) : BaseCommand(type) {};
             virtual ~CompositeCommand() = default;
             /// @brief Add a child command to the current one
-            /// @param child the sub command to add
+            /// @param child the sub command to add (its translations must already be defined)
             void addChild(std::shared_ptr<BaseCommand> child) override;
 
             /// @brief Get the child command associated to a given name
@@ -209,6 +234,26 @@ namespace abase {
             auto sub = command->get_child(child_name);
             if (sub) sub->get_values(values);
         }
+
+        /// @brief Get a view on the values of a child command (without copy of the values)
+        /// @tparam T type of the values
+        /// @param command main command
+        /// @param child_name child command name
+        /// @param values view on the values associated to the child command
+        template<typename T>
+        void get_child_values(const std::shared_ptr<abase::BaseCommand>& command, const std::string& child_name, Span<const T>& values) {
+            auto sub = command->get_child(child_name);
+            if (sub) sub->get_values(values);
+        }
+
+        /// @brief Get ranges of values from a child command
+        /// @param command main command
+        /// @param child_name child command name
+        /// @param values ranges of values associated to the child command
+        inline void get_child_values(const std::shared_ptr<abase::BaseCommand>& command, const std::string& child_name, RangeList& values) {
+            auto sub = command->get_child(child_name);
+            if (sub) sub->get_values(values);
+        }
     }
 
 }
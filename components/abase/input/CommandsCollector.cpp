@@ -1,97 +1,68 @@
 #include "Commands.h"
 #include "CommandsCollector.h"
+#include "CommandsGrammar.h"
 #include "CommandsTypeFactory.h"
 #include "Environment.h"
-#include "Filesystem.h"
-
-#include "yaml-cpp/yaml.h"
 
 using namespace abase;
 
-/// @brief Get the command type from the YAML node position (internal function without outside access)
-/// @param node position in the YAML tree
-/// @return the command type
-std::string get_command_type(const YAML::Node& node) {
-    for (const auto& key : node) {
-        if (key.first.as<std::string>() == "type") return key.second.as<std::string>();
-    }
-    return "";
-}
-
-/// @brief Get the command keys from the YAML node position (internal function without outside access)
-/// @param node position in the YAML tree
-/// @return the associated keys
-std::unordered_map<std::string, std::vector<std::string>> get_command_keys(const std::string& node_name, 
-                                                                           const YAML::Node& node) {
-    std::unordered_map<std::string, std::vector<std::string>> translations;
-
-    for (const auto& key : node) {
-        std::string str_key = key.first.as<std::string>();
-        if (str_key != "keys") continue;
-        for (const auto& translation : key.second) {
-            std::string lang = translation.first.as<std::string>();
-            std::vector<std::string> keys = translation.second.as<std::vector<std::string>>();
-            translations[lang] = keys;
-        }
-    }
-
-    // if no keys are found, return an error
-    if (translations.empty()) {
-        error(translate("ERROR_FACTORY_UNDEFINED_PARAMETER", {"keys", node_name}));
-    }
-
-    return translations;
-}
-
-/// @brief Create a command object based on informattions read in YAML file (internal function without outside access).
-/// The function is recursive to add all children commands.
-/// @param node position in the YAML tree
+/// @brief Create a command object from its definition in a compiled grammar (internal function without outside 
+/// access). The function is recursive to add all children commands.
+/// @param node definition of the command
+/// @param arena arena storing the command tree
 /// @return the command object
-std::shared_ptr<BaseCommand> add_command(const std::string node_name, const YAML::Node& node) {
-    // get the command type
-    std::string ntype = get_command_type(node);
-    if (ntype.empty()) {
-        error(translate("ERROR_FACTORY_UNDEFINED_PARAMETER", {"type", node_name}));
-    }
-
+std::shared_ptr<BaseCommand> add_command(const GrammarNode& node, Arena& arena) {
     // create the command by its type
-    std::shared_ptr<BaseCommand> command = CommandsTypeFactory::create_command(ntype);
+    std::shared_ptr<BaseCommand> command = CommandsTypeFactory::create_command(node.type, arena);
     if (command == nullptr) {
-        error(translate("ERROR_FACTORY_UNKNOWN", node_name));
+        error(translate("ERROR_FACTORY_UNKNOWN", node.name));
     }
 
     // set the name and the translations
-    command->set_name(node_name);
-    for (const auto& translation : get_command_keys(node_name, node)) {
+    command->set_name(node.name);
+    for (const auto& translation : node.translations) {
         command->set_translation(translation.first, translation.second);
     }
     
     //add children
-    for (const auto& child : node) {
-        std::string childname = child.first.as<std::string>();
-        if (childname == "keys" || childname == "type") continue;
-        command->addChild( add_command(childname, child.second) );
+    for (const auto& child : node.children) {
+        command->addChild( add_command(child, arena) );
     }
 
     return command;
 }
 
 void CommandsCollector::loadCommandsFromFile(const std::string& filename) {
-    // Check the file type and status before loading
-    if ( !is_file_readable(filename) ) {
-        error(translate("ERROR_FACTORY_FILE", filename));
-    }
+    // Get the compiled grammar (shared with the other collectors using the same file)
+    std::shared_ptr<const CommandsGrammar> grammar = CommandsGrammar::load(filename);
 
     // Clear previous commands
     clear();
 
-    // Real the YAML file
-    YAML::Node node = YAML::LoadFile(filename);
-
     // Add all commands and their children to the collector
-    for (const auto& key : node) {
-        std::string str_key = key.first.as<std::string>();
-        commands[str_key] = add_command(str_key, key.second);
+    for (const auto& node : grammar->get_commands()) {
+        commands[node.name] = add_command(node, *arena);
+    }
+
+    // Compile the keywords of all commands
+    build_keywords();
+}
+
+void CommandsCollector::add_keywords(const std::shared_ptr<BaseCommand>& command, std::uint32_t rank) {
+    for (const auto& translation : command->get_translations()) {
+        keywords.insert(translation.second, rank);
+    }
+    for (const auto& name : command->get_children_names()) {
+        add_keywords(command->get_child(name), CHILD_RANK);
+    }
+}
+
+void CommandsCollector::build_keywords() {
+    keywords.clear();
+    ranked_commands.clear();
+    for (const auto& command : commands) {
+        add_keywords(command.second, static_cast<std::uint32_t>(ranked_commands.size()));
+        ranked_commands.push_back(command.second);
     }
 }
 
@@ -103,11 +74,15 @@ std::shared_ptr<BaseCommand> CommandsCollector::get_command(const std::string& n
 }
 
 std::string CommandsCollector::get_command_name_by_keyword(const std::string& keyword) const {
-    for (const auto& command : commands) {
-        if (command.second->is_same_keyword(keyword)) 
-            return command.second->get_name();
-    }
-    return "";
+    auto command = get_command_by_keyword(keyword);
+    if (command == nullptr) return "";
+    return command->get_name();
+}
+
+std::shared_ptr<BaseCommand> CommandsCollector::get_command_by_keyword(const std::string& keyword) const {
+    std::uint32_t rank = keywords.find(keyword);
+    if (rank >= ranked_commands.size()) return nullptr;
+    return ranked_commands[rank];
 }
 
 std::vector<std::string> CommandsCollector::get_commands_names() {
@@ -119,8 +94,5 @@ std::vector<std::string> CommandsCollector::get_commands_names() {
 }
 
 bool CommandsCollector::is_command_name(const std::string& name) const {
-    for (const auto& command : commands) {
-        if (command.second->is_command_name(name)) return true;
-    }
-    return false;
+    return keywords.find(name) != KeywordTrie::NO_RANK;
 }
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#include "BinaryArchive.h"
+#include "Environment.h"
+#include "Filesystem.h"
+#include "MappedFile.h"
+
+#include "CommandsGrammar.h"
+
+#include "yaml-cpp/yaml.h"
+
+using namespace abase;
+
+namespace {
+    /// @brief Identifier written at the beginning of a cache file
+    constexpr char CACHE_MAGIC[4] = {'A', 'C', 'G', 'R'};
+    /// @brief Upper bound of the numbers of commands read in a cache file (a larger number means a corrupted file)
+    constexpr std::uint64_t CACHE_MAX_SIZE = 1U << 20;
+
+    /// @brief Grammars already loaded (or being loaded by another thread) by the process, by hash and size of their
+    /// YAML content
+    std::map<std::pair<std::uint64_t, std::uint64_t>,
+             std::shared_future<std::shared_ptr<const CommandsGrammar>>> loaded_grammars;
+    /// @brief Mutex protecting the loaded grammars (not held while a grammar is read or compiled)
+    std::mutex loaded_grammars_mutex;
+
+    /// @brief Return the FNV-1a hash of a content
+    std::uint64_t content_hash(const std::string& content) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char ch : content) {
+            hash ^= ch;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    //
+    // YAML reading
+    //
+
+    /// @brief Get the command type from the YAML node position
+    /// @param node position in the YAML tree
+    /// @return the command type
+    std::string get_command_type(const YAML::Node& node) {
+        for (const auto& key : node) {
+            if (key.first.as<std::string>() == "type") return key.second.as<std::string>();
+        }
+        return "";
+    }
+
+    /// @brief Get the command keys from the YAML node position
+    /// @param node_name name of the command
+    /// @param node position in the YAML tree
+    /// @return the associated keys for each language
+    std::vector<std::pair<std::string, std::vector<std::string>>> get_command_keys(const std::string& node_name,
+                                                                                   const YAML::Node& node) {
+        std::vector<std::pair<std::string, std::vector<std::string>>> translations;
+
+        for (const auto& key : node) {
+            std::string str_key = key.first.as<std::string>();
+            if (str_key != "keys") continue;
+            for (const auto& translation : key.second) {
+                std::string lang = translation.first.as<std::string>();
+                translations.push_back({lang, translation.second.as<std::vector<std::string>>()});
+            }
+        }
+
+        // if no keys are found, return an error
+        if (translations.empty()) {
+            error(translate("ERROR_FACTORY_UNDEFINED_PARAMETER", {"keys", node_name}));
+        }
+
+        return translations;
+    }
+
+    /// @brief Build the definition of a command from the YAML tree. The function is recursive to add all children.
+    /// @param node_name name of the command
+    /// @param node position in the YAML tree
+    /// @return the command definition
+    GrammarNode compile_node(const std::string& node_name, const YAML::Node& node) {
+        GrammarNode command;
+        command.name = node_name;
+        command.type = get_command_type(node);
+        if (command.type.empty()) {
+            error(translate("ERROR_FACTORY_UNDEFINED_PARAMETER", {"type", node_name}));
+        }
+        command.translations = get_command_keys(node_name, node);
+
+        for (const auto& child : node) {
+            std::string childname = child.first.as<std::string>();
+            if (childname == "keys" || childname == "type") continue;
+            command.children.push_back(compile_node(childname, child.second));
+        }
+        return command;
+    }
+
+    //
+    // Binary cache
+    //
+
+    void write_node(BinaryWriter& writer, const GrammarNode& node) {
+        writer.write(node.name);
+        writer.write(node.type);
+        writer.write(static_cast<std::uint64_t>(node.translations.size()));
+        for (const auto& translation : node.translations) {
+            writer.write(translation.first);
+            writer.write(translation.second);
+        }
+        writer.write(static_cast<std::uint64_t>(node.children.size()));
+        for (const auto& child : node.children) write_node(writer, child);
+    }
+
+    bool read_node(BinaryReader& reader, GrammarNode& node) {
+        std::uint64_t count = 0;
+        reader.read(node.name);
+        reader.read(node.type);
+
+        if (!reader.read(count) || count > CACHE_MAX_SIZE) return false;
+        node.translations.resize(count);
+        for (auto& translation : node.translations) {
+            reader.read(translation.first);
+            reader.read(translation.second);
+        }
+
+        if (!reader.read(count) || count > CACHE_MAX_SIZE) return false;
+        node.children.resize(count);
+        for (auto& child : node.children) {
+            if (!read_node(reader, child)) return false;
+        }
+        return reader.good();
+    }
+}
+
+std::shared_ptr<const CommandsGrammar> CommandsGrammar::load(const std::string& filename) {
+    // Check the file type and status before loading
+    if ( !is_file_readable(filename) ) {
+        error(translate("ERROR_FACTORY_FILE", filename));
+    }
+
+    std::ifstream input(filename, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    auto grammar = std::make_shared<CommandsGrammar>();
+    grammar->hash = content_hash(content);
+    grammar->size = content.size();
+    std::pair<std::uint64_t, std::uint64_t> key = {grammar->hash, grammar->size};
+
+    // the first thread loading a content registers its future result, the other ones wait for it
+    std::promise<std::shared_ptr<const CommandsGrammar>> promise;
+    std::shared_future<std::shared_ptr<const CommandsGrammar>> loaded;
+    {
+        std::lock_guard<std::mutex> lock(loaded_grammars_mutex);
+        auto it = loaded_grammars.find(key);
+        if (it != loaded_grammars.end()) loaded = it->second;
+        else loaded_grammars.emplace(key, promise.get_future().share());
+    }
+    if (loaded.valid()) return loaded.get();
+
+    // the cache is read or the content compiled without the lock: different grammars are loaded concurrently
+    try {
+        std::string cachename = filename + ".cache";
+        if (!grammar->read_cache(cachename)) {
+            grammar->compile(content);
+            grammar->write_cache(cachename);
+        }
+    } catch (...) {
+        // a failed load is not kept: the next load of the content tries again
+        {
+            std::lock_guard<std::mutex> lock(loaded_grammars_mutex);
+            loaded_grammars.erase(key);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+    promise.set_value(grammar);
+    return grammar;
+}
+
+void CommandsGrammar::compile(const std::string& content) {
+    commands.clear();
+    YAML::Node node = YAML::Load(content);
+    for (const auto& key : node) {
+        std::string str_key = key.first.as<std::string>();
+        commands.push_back(compile_node(str_key, key.second));
+    }
+}
+
+bool CommandsGrammar::read_cache(const std::string& cachename) {
+    MappedFile cache(cachename);
+    if (!cache.is_mapped()) return false;
+    BinaryReader reader(cache.content());
+
+    // check the format and the content used to build the cache
+    if (reader.read_bytes(sizeof(CACHE_MAGIC)) != std::string_view(CACHE_MAGIC, sizeof(CACHE_MAGIC))) return false;
+    std::uint64_t version = 0, cache_hash = 0, cache_size = 0;
+    if (!reader.read(version) || version != CACHE_VERSION) return false;
+    if (!reader.read(cache_hash) || cache_hash != hash) return false;
+    if (!reader.read(cache_size) || cache_size != size) return false;
+
+    std::uint64_t count = 0;
+    if (!reader.read(count) || count > CACHE_MAX_SIZE) return false;
+    std::vector<GrammarNode> nodes(count);
+    for (auto& node : nodes) {
+        if (!read_node(reader, node)) return false;
+    }
+    if (!reader.at_end()) return false;
+    commands = std::move(nodes);
+    return true;
+}
+
+void CommandsGrammar::write_cache(const std::string& cachename) const {
+    BinaryWriter writer;
+    writer.write_bytes(std::string_view(CACHE_MAGIC, sizeof(CACHE_MAGIC)));
+    writer.write(static_cast<std::uint64_t>(CACHE_VERSION));
+    writer.write(hash);
+    writer.write(size);
+    writer.write(static_cast<std::uint64_t>(commands.size()));
+    for (const auto& node : commands) write_node(writer, node);
+    writer.save(cachename);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace abase {
+
+    /// @brief Definition of a command in a compiled grammar
+    struct GrammarNode {
+        /// @brief command name
+        std::string name;
+        /// @brief command type (see CommandsTypeFactory)
+        std::string type;
+        /// @brief keys of the command for each language
+        std::vector<std::pair<std::string, std::vector<std::string>>> translations;
+        /// @brief children commands (in the order of the YAML file)
+        std::vector<GrammarNode> children;
+    };
+
+    /// @class CommandsGrammar
+    /// @brief Compiled form of a commands tree defined by a YAML file.
+    ///
+    /// The YAML file is only parsed when its compiled form is not available: the compiled grammar is stored in a
+    /// binary cache file next to the YAML file (`<file>.cache`) and identified by the hash of the YAML content. A cache
+    /// built from another content or by another version of the format is ignored and rebuilt. Within a process, a
+    /// grammar is compiled or read once and shared by all the collectors using the same content.
+    class CommandsGrammar {
+        private:
+            /// @brief version of the binary format of the cache file
+            static constexpr std::uint32_t CACHE_VERSION = 1;
+
+            /// @brief hash of the YAML content
+            std::uint64_t hash = 0;
+            /// @brief size of the YAML content
+            std::uint64_t size = 0;
+            /// @brief main commands (in the order of the YAML file)
+            std::vector<GrammarNode> commands;
+
+            /// @brief Build the grammar from the YAML content
+            /// @param content content of the YAML file
+            void compile(const std::string& content);
+            /// @brief Read the grammar from its cache file
+            /// @param cachename path to the cache file
+            /// @return true if the cache file exists and matches the YAML content
+            bool read_cache(const std::string& cachename);
+            /// @brief Write the grammar in its cache file (nothing is done if the file cannot be written)
+            /// @param cachename path to the cache file
+            void write_cache(const std::string& cachename) const;
+
+        public:
+            /// @brief Return the compiled grammar of a YAML file (thread-safe: different files are loaded concurrently,
+            /// a content already being loaded by another thread is waited for)
+            /// @param filename path to the YAML file
+            /// @return the shared grammar
+            static std::shared_ptr<const CommandsGrammar> load(const std::string& filename);
+
+            /// @brief Return the main commands (in the order of the YAML file)
+            const std::vector<GrammarNode>& get_commands() const { return commands; }
+    };
+
+}
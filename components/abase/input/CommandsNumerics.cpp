@@ -1,6 +1,5 @@
 #include <algorithm>
 #include <cctype>
-#include <sstream>
 #include <cassert>
 
 #include "CommandsNumerics.h"
@@ -11,21 +10,8 @@ using namespace abase;
 
 template<typename T>
 std::pair<T, bool> NumericCommand<T>::convert_value(const std::string& key, FileReader& reader) {
-    T output_value;
-    bool status = true;
-    std::string str_value = reader.get_word();
-    std::string delimiters = STRING_DELIMITER;
-
-    // Replace the string delimiters with a special string to avoid issue with stringstream.
-    for (std::size_t i = 0; i < delimiters.size(); i++) {
-        str_value = str::replace(str_value, delimiters.substr(i, 1), "&");
-    }
-
-    // Convert the string to the expected type.
-    std::stringstream ss(str_value);
-    ss >> output_value;
-
-    if (ss.fail() || !ss.eof()) status = false;
+    T output_value = T();
+    bool status = str::to_number(reader.get_word(), output_value);
     return {output_value , status};
 }
 
@@ -83,9 +69,7 @@ std::size_t MixCommand<T>::read_input(FileReader& reader, const CommandsCollecto
 
     // Read the number of expected values
     std::string str_value = reader.get_word();
-    std::stringstream ss(str_value);
-    ss >> _n_values;
-    if (ss.fail() || !ss.eof()) {
+    if (!str::to_number(str_value, _n_values)) {
         std::string filecontext = reader.context_error();
         file_input_error(translate("ERROR_TYPE_CONVERSION", {key, str_value}), filecontext);
     }
@@ -48,10 +48,14 @@ namespace abase {
     class VectorCommand : public NumericCommand<T> {
         protected :
             /// @brief Vector of values associated to the command
-            std::vector<T> _values;
+            std::pmr::vector<T> _values;
 
         public :
-            VectorCommand(const std::string& type) : NumericCommand<T>(type) {};
+            /// @brief Constructor
+            /// @param type command type
+            /// @param resource memory resource used to store the values
+            VectorCommand(const std::string& type, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : NumericCommand<T>(type), _values(resource) {};
             virtual ~VectorCommand() = default;
 
             /// @brief clear read data associated to the command
@@ -63,7 +67,12 @@ namespace abase {
             virtual std::size_t read_input(FileReader& reader, const CommandsCollector& collector) override;
             /// @brief Get the values of the command
             /// @param values values associated to the command
-            void get_values(std::vector<T>& values) const override { if (this->_read_status) values = _values; }
+            void get_values(std::vector<T>& values) const override {
+                if (this->_read_status) values.assign(_values.begin(), _values.end());
+            }
+            /// @brief Get a view on the values of the command
+            /// @param values view on the values associated to the command
+            void get_values(Span<const T>& values) const override { if (this->_read_status) values = Span<const T>(_values); }
     };
 
     /// @class MixCommand
@@ -72,12 +81,16 @@ namespace abase {
     class MixCommand : public NumericCommand<T> {
         protected :
             /// @brief Vector of values associated to the command
-            std::vector<T> _values;
+            std::pmr::vector<T> _values;
             /// @brief Number of values to read
             std::size_t _n_values;
 
         public :
-            MixCommand(const std::string& type) : NumericCommand<T>(type) {};
+            /// @brief Constructor
+            /// @param type command type
+            /// @param resource memory resource used to store the values
+            MixCommand(const std::string& type, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : NumericCommand<T>(type), _values(resource) {};
             virtual ~MixCommand() = default;
 
             /// @brief clear read data associated to the command
@@ -89,7 +102,12 @@ namespace abase {
             virtual std::size_t read_input(FileReader& reader, const CommandsCollector& collector) override;
             /// @brief Get the values of the command
             /// @param values values associated to the command
-            void get_values(std::vector<T>& values) const override { if (this->_read_status) values = _values; }
+            void get_values(std::vector<T>& values) const override {
+                if (this->_read_status) values.assign(_values.begin(), _values.end());
+            }
+            /// @brief Get a view on the values of the command
+            /// @param values view on the values associated to the command
+            void get_values(Span<const T>& values) const override { if (this->_read_status) values = Span<const T>(_values); }
     };
 }
 
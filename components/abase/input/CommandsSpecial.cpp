@@ -21,33 +21,16 @@ std::size_t SingleCommand::read_input(FileReader& reader, const CommandsCollecto
     return 0;
 }
 
-std::vector<std::size_t> TimeStepCommand::convert_range(const std::string& start, const std::string& end,
-                                                        const std::string& step, bool& status) {
-    std::vector<std::size_t> range;
-    try {
-        std::size_t start_value = std::stoull(start);
-        std::size_t end_value = std::stoull(end);
-        std::size_t step_value = std::stoull(step);
-
-        if (step_value == 0) {
-            status = false;
-            return range;
-        }
-
-        for (std::size_t value = start_value; value <= end_value; value += step_value) {
-            range.push_back(value);
-        }
-        status = true;
-    } catch (const std::invalid_argument& e) {
-        status = false;
-    } catch (const std::out_of_range& e) {
-        status = false;
-    }
-    return range;
+void TimeStepCommand::convert_range(const std::string& start, const std::string& end, const std::string& step,
+                                    bool& status, RangeList& timesteps) {
+    std::size_t start_value, end_value, step_value;
+    status = str::parse_number(start, start_value) > 0 && str::parse_number(end, end_value) > 0 &&
+             str::parse_number(step, step_value) > 0 && step_value != 0;
+    if (status) timesteps.add_range(start_value, end_value, step_value);
 }
 
-std::vector<std::size_t> TimeStepCommand::split_sequence(const std::string& sequence, bool& status) {
-    std::vector<std::size_t> timesteps;
+RangeList TimeStepCommand::split_sequence(const std::string& sequence, bool& status) {
+    RangeList timesteps;
 
     // Replace the keywords by special characters and split it.
     std::string s = str::trim(sequence);
@@ -82,9 +65,8 @@ std::vector<std::size_t> TimeStepCommand::split_sequence(const std::string& sequ
         }
 
         // Convert the string values to unsigned integers.
-        std::vector<std::size_t> range = convert_range(start, end, step, status);
+        convert_range(start, end, step, status, timesteps);
         if (!status) return timesteps;
-        timesteps.insert(timesteps.end(), range.begin(), range.end());
     }
 
     return timesteps;
@@ -125,15 +107,12 @@ std::size_t TimeStepCommand::read_input(FileReader& reader, const CommandsCollec
 
 void TableCommand::convert(const std::vector<std::string>& values, bool& status) {
     for (const auto& value : values) {
-        try {
-            _values.push_back( std::stod(value) );
-        } catch (const std::invalid_argument& e) {
-            status = false;
-            return;
-        } catch (const std::out_of_range& e) {
+        double number;
+        if (str::parse_number(value, number) == 0) {
             status = false;
             return;
         }
+        _values.push_back(number);
     }
 }
 
@@ -201,21 +180,18 @@ std::size_t CoefficientCommand::convert(const std::vector<std::string>& values,
     for (const auto& value : values) {
         pos++;
         if (value == "TABLE") break;
-        try {
-            _values.push_back( std::stod(value) );
-        } catch (const std::invalid_argument& e) {
-            status = false;
-            return pos;
-        } catch (const std::out_of_range& e) {
+        double number;
+        if (str::parse_number(value, number) == 0) {
             status = false;
             return pos;
         }
+        _values.push_back(number);
     }
     return pos;
 }
 
 void CoefficientCommand::split_sequence(const std::string& sequence, const std::string& key, 
-                                        const std::string& filecontext) {
+                                        const FileContext& filecontext) {
     std::vector<std::string> str_values = str::split(sequence);
     bool status = true;
     std::size_t table_pos = convert(str_values, status);
@@ -266,7 +242,7 @@ std::size_t CoefficientCommand::read_input(FileReader& reader, const CommandsCol
         str_value = reader.get_word();
     }
 
-    std::string filecontext = reader.context_error();
+    FileContext filecontext = reader.context();
     if (sequence.empty()) file_input_error(translate("ERROR_UNREADABLE_COEFFICIENT", key), filecontext);
     split_sequence(sequence, key, filecontext);
 
@@ -31,22 +31,22 @@ namespace abase {
     /// @brief Class used to read time steps from the input file
     class TimeStepCommand : public CompositeCommand {
         private:
-            /// @brief Convert a time step range into a vector of time steps
+            /// @brief Convert a time step range and add it to a list of time steps
             /// @param start first time step
             /// @param end last time step
             /// @param step time step increment
             /// @param status status of the conversion
-            /// @return a vector of time steps
-            std::vector<std::size_t> convert_range(const std::string& start, const std::string& end,
-                                                   const std::string& step, bool& status);
+            /// @param timesteps list of time steps where the range is added
+            void convert_range(const std::string& start, const std::string& end, const std::string& step, 
+                               bool& status, RangeList& timesteps);
             /// @brief Extract all time steps from a sequence of strings
             /// @param sequence extracted sequence
             /// @param status status of the extraction
-            /// @return a vector of time steps
-            std::vector<std::size_t> split_sequence(const std::string& sequence, bool& status);
+            /// @return the list of time steps (stored as ranges)
+            RangeList split_sequence(const std::string& sequence, bool& status);
         protected :
-            /// @brief vector of time steps rank.
-            std::vector<std::size_t> _values;
+            /// @brief time steps rank (stored as ranges)
+            RangeList _values;
 
         public:
             TimeStepCommand(const std::string& type) : CompositeCommand(type) {};
@@ -61,7 +61,12 @@ namespace abase {
             virtual std::size_t read_input(FileReader& reader, const CommandsCollector& collector) override;
             /// @brief Get the values of the command
             /// @param values values associated to the command
-            void get_values(std::vector<std::size_t>& values) const override { if (_read_status) values = _values; }
+            void get_values(std::vector<std::size_t>& values) const override { 
+                if (_read_status) values = _values.to_vector(); 
+            }
+            /// @brief Get the values of the command without expanding the ranges
+            /// @param values values associated to the command
+            void get_values(RangeList& values) const override { if (_read_status) values = _values; }
     };
 
     /// @class TableCommand
@@ -80,10 +85,14 @@ namespace abase {
             /// @brief table name
             std::string _table_name;
             /// @brief vector of time steps rank.
-            std::vector<double> _values;
+            std::pmr::vector<double> _values;
 
         public:
-            TableCommand(const std::string& type) : CompositeCommand(type) {};
+            /// @brief Constructor
+            /// @param type command type
+            /// @param resource memory resource used to store the values
+            TableCommand(const std::string& type, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : CompositeCommand(type), _values(resource) {};
             virtual ~TableCommand() = default;
 
             /// @brief clear read data associated to the command
@@ -98,7 +107,12 @@ namespace abase {
             void get_value(std::string& name) const override { if (_read_status) name = _table_name; }
             /// @brief Get the values of the command
             /// @param values values associated to the command
-            void get_values(std::vector<double>& values) const override { if (_read_status) values = _values; }
+            void get_values(std::vector<double>& values) const override {
+                if (_read_status) values.assign(_values.begin(), _values.end());
+            }
+            /// @brief Get a view on the values of the command
+            /// @param values view on the values associated to the command
+            void get_values(Span<const double>& values) const override { if (_read_status) values = Span<const double>(_values); }
             
     };
 
@@ -115,15 +129,19 @@ namespace abase {
             /// @param sequence extracted sequence
             /// @param key key associated to the coefficient
             /// @param filecontext file context for error message
-            void split_sequence(const std::string& sequence, const std::string & key, const std::string& filecontext);
+            void split_sequence(const std::string& sequence, const std::string & key, const FileContext& filecontext);
         protected :
             /// @brief table name associated to the coefficient
             std::string _table_name;
             /// @brief Values associated to the coefficient (expected size is 0 or 1)
-            std::vector<double> _values;
+            std::pmr::vector<double> _values;
 
         public:
-            CoefficientCommand(const std::string& type) : CompositeCommand(type) {};
+            /// @brief Constructor
+            /// @param type command type
+            /// @param resource memory resource used to store the values
+            CoefficientCommand(const std::string& type, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : CompositeCommand(type), _values(resource) {};
             virtual ~CoefficientCommand() = default;
 
             /// @brief clear read data associated to the command
@@ -138,7 +156,12 @@ namespace abase {
             void get_value(std::string& name) const override { if (_read_status) name = _table_name; }
             /// @brief Get the values of the command associated to the coefficient
             /// @param values values associated to the command
-            void get_values(std::vector<double>& values) const override { if (_read_status) values = _values; }
+            void get_values(std::vector<double>& values) const override {
+                if (_read_status) values.assign(_values.begin(), _values.end());
+            }
+            /// @brief Get a view on the values of the command
+            /// @param values view on the values associated to the command
+            void get_values(Span<const double>& values) const override { if (_read_status) values = Span<const double>(_values); }
     };
 
     /// @class FileCommand
@@ -10,7 +10,7 @@ namespace abase {
             /// @brief Convert read data from input file into data objects
             /// @param command read data from the input file
             /// @param filecontext file context
-            virtual void set_data(const std::shared_ptr<BaseCommand>& command, const std::string& filecontext) = 0;
+            virtual void set_data(const std::shared_ptr<BaseCommand>& command, const FileContext& filecontext) = 0;
 
             /// @brief Read special line without any command
             /// @param command_name name of the command linked to the special line
@@ -19,6 +19,9 @@ namespace abase {
             /// @note By default, empty implementation
             virtual void read_special_line(const std::string& command_name, FileReader& reader, 
                                            const CommandsCollector& collector) {};
+            /// @brief Return true if the reading of the input file must stop after the current command
+            /// @note By default, the whole input file is read
+            virtual bool is_reading_stopped() const { return false; }
 
         public:
             DataCollector() = default;
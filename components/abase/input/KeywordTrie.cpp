@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cctype>
+
+#include "KeywordTrie.h"
+
+using namespace abase;
+
+std::uint32_t KeywordTrie::child(std::uint32_t node, char ch) const {
+    for (const auto& edge : nodes[node].edges) {
+        if (edge.first == ch) return edge.second;
+    }
+    return NO_RANK;
+}
+
+void KeywordTrie::insert(const std::vector<std::string>& keys, std::uint32_t rank) {
+    if (keys.empty()) return;
+
+    bool exact = (keys.size() == 1);
+    const std::string& key = exact ? keys[0] : keys[1];
+    std::uint32_t min_length = static_cast<std::uint32_t>(keys[0].size());
+
+    std::uint32_t node = 0;
+    for (std::size_t depth = 0; depth <= key.size(); ++depth) {
+        if (!exact && min_length <= depth) {
+            auto& ranks = nodes[node].prefix_ranks;
+            auto pos = std::lower_bound(ranks.begin(), ranks.end(), rank);
+            if (pos == ranks.end() || *pos != rank) ranks.insert(pos, rank);
+        }
+        if (depth == key.size()) break;
+
+        std::uint32_t next = child(node, key[depth]);
+        if (next == NO_RANK) {
+            next = static_cast<std::uint32_t>(nodes.size());
+            nodes[node].edges.push_back({key[depth], next});
+            nodes.emplace_back();
+        }
+        node = next;
+    }
+    nodes[node].ends.push_back({rank, min_length, exact});
+}
+
+std::uint32_t KeywordTrie::find(std::string_view word, std::uint32_t from_rank) const {
+    if (word.empty()) return NO_RANK;
+
+    std::uint32_t best = NO_RANK;
+    std::uint32_t node = 0;
+    for (std::size_t depth = 0; depth <= word.size(); ++depth) {
+        bool last = (depth == word.size());
+
+        // keys ending at this node: equal to the word or prefix of the word
+        for (const auto& entry : nodes[node].ends) {
+            if (entry.rank < from_rank) continue;
+            if (entry.exact ? last : word.size() >= entry.min_length) best = std::min(best, entry.rank);
+        }
+        if (last) {
+            // the word is a prefix of the long keys passing through this node
+            const auto& ranks = nodes[node].prefix_ranks;
+            auto pos = std::lower_bound(ranks.begin(), ranks.end(), from_rank);
+            if (pos != ranks.end()) best = std::min(best, *pos);
+            break;
+        }
+
+        char ch = static_cast<char>(std::tolower(static_cast<unsigned char>(word[depth])));
+        node = child(node, ch);
+        if (node == NO_RANK) break;
+    }
+    return best;
+}
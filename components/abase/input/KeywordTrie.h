@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace abase {
+
+    /// @class KeywordTrie
+    /// @brief Case-insensitive prefix tree of command keywords, used to recognise a word of an input file in a
+    /// single pass over its characters (without allocation).
+    ///
+    /// Each command is inserted with the keys of all its translations. For a pair of keys (short key, long key), a
+    /// word matches if it is not shorter than the short key and if it is a prefix of the long key or starts with the
+    /// long key (same rule as `BaseCommand::is_same_keyword`). For a single key, the word must be equal to the key.
+    ///
+    /// Each key is associated to a rank. When several commands match a word, the lowest rank is returned (or the lowest
+    /// rank not lower than a given one, in order to resume a scan of ordered commands).
+    class KeywordTrie {
+        public:
+            /// @brief Rank returned when no command matches
+            static constexpr std::uint32_t NO_RANK = std::numeric_limits<std::uint32_t>::max();
+
+        private:
+            /// @brief Key ending at a node
+            struct Entry {
+                /// @brief rank of the command
+                std::uint32_t rank = NO_RANK;
+                /// @brief minimal length of a matching word (short key length)
+                std::uint32_t min_length = 0;
+                /// @brief true if the word must be equal to the key
+                bool exact = false;
+            };
+
+            /// @brief Node of the tree
+            struct Node {
+                /// @brief edges to the children nodes (character, node index)
+                std::vector<std::pair<char, std::uint32_t>> edges;
+                /// @brief keys ending at this node
+                std::vector<Entry> ends;
+                /// @brief sorted ranks of the pairs of keys passing through this node whose short key is not longer
+                /// than the node depth: a word ending at this node matches these commands.
+                std::vector<std::uint32_t> prefix_ranks;
+            };
+
+            /// @brief nodes of the tree (the root is the first node)
+            std::vector<Node> nodes = std::vector<Node>(1);
+
+            /// @brief Return the child of a node for a character
+            /// @param node node index
+            /// @param ch character
+            /// @return child index or NO_RANK if undefined
+            std::uint32_t child(std::uint32_t node, char ch) const;
+
+        public:
+            KeywordTrie() = default;
+
+            /// @brief Remove all keys
+            void clear() { nodes = std::vector<Node>(1); }
+
+            /// @brief Add the keys of a command translation
+            /// @param keys keys of the translation (single key or pair of short and long keys)
+            /// @param rank rank associated to the command
+            void insert(const std::vector<std::string>& keys, std::uint32_t rank);
+
+            /// @brief Return the lowest rank of the commands matching a word
+            /// @param word word read in the input file
+            /// @param from_rank lowest rank accepted
+            /// @return lowest rank (not lower than `from_rank`) or NO_RANK if no command matches
+            std::uint32_t find(std::string_view word, std::uint32_t from_rank = 0) const;
+    };
+
+}
@@ -0,0 +1,22 @@
+#include <algorithm>
+
+#include "Arena.h"
+
+using namespace abase;
+
+void* Arena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    if (std::align(alignment, bytes, current, remaining) == nullptr) {
+        // new chunk large enough for the request and its alignment
+        std::size_t size = std::max(chunk_size, bytes + alignment);
+        chunks.push_back(std::make_unique<std::byte[]>(size));
+        current = chunks.back().get();
+        remaining = size;
+        std::align(alignment, bytes, current, remaining);
+    }
+
+    void* block = current;
+    current = static_cast<std::byte*>(current) + bytes;
+    remaining -= bytes;
+    used += bytes;
+    return block;
+}
@@ -0,0 +1,123 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+#include "BinaryArchive.h"
+
+using namespace abase;
+
+//
+// Writer
+//
+
+void BinaryWriter::write(std::uint64_t value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void BinaryWriter::write(double value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void BinaryWriter::write(const std::string& value) {
+    write(static_cast<std::uint64_t>(value.size()));
+    buffer.append(value);
+}
+
+void BinaryWriter::write(const std::vector<double>& values) {
+    write(static_cast<std::uint64_t>(values.size()));
+    buffer.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+}
+
+void BinaryWriter::write(const std::vector<std::string>& values) {
+    write(static_cast<std::uint64_t>(values.size()));
+    for (const auto& value : values) write(value);
+}
+
+bool BinaryWriter::save(const std::string& filename) const {
+    std::string tmpname = filename + "." + std::to_string(::getpid());
+    {
+        std::ofstream output(tmpname, std::ios::binary | std::ios::trunc);
+        if (!output) return false;
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        output.close();
+        if (!output) {
+            std::error_code status;
+            std::filesystem::remove(tmpname, status);
+            return false;
+        }
+    }
+
+    std::error_code status;
+    std::filesystem::rename(tmpname, filename, status);
+    if (status) {
+        std::filesystem::remove(tmpname, status);
+        return false;
+    }
+    return true;
+}
+
+//
+// Reader
+//
+
+const char* BinaryReader::take(std::size_t size) {
+    if (!status || size > data.size() - position) {
+        status = false;
+        return nullptr;
+    }
+    const char* start = data.data() + position;
+    position += size;
+    return start;
+}
+
+std::string_view BinaryReader::read_bytes(std::size_t size) {
+    const char* start = take(size);
+    if (start == nullptr) return std::string_view();
+    return std::string_view(start, size);
+}
+
+bool BinaryReader::read(std::uint64_t& value) {
+    const char* start = take(sizeof(value));
+    if (start != nullptr) std::memcpy(&value, start, sizeof(value));
+    return status;
+}
+
+bool BinaryReader::read(double& value) {
+    const char* start = take(sizeof(value));
+    if (start != nullptr) std::memcpy(&value, start, sizeof(value));
+    return status;
+}
+
+bool BinaryReader::read(std::string& value) {
+    std::uint64_t size = 0;
+    if (!read(size)) return false;
+    const char* start = take(size);
+    if (start != nullptr) value.assign(start, size);
+    return status;
+}
+
+bool BinaryReader::read(std::vector<double>& values) {
+    std::uint64_t size = 0;
+    if (!read(size) || size > (data.size() - position) / sizeof(double)) {
+        status = false;
+        return false;
+    }
+    const char* start = take(size * sizeof(double));
+    values.resize(size);
+    if (size > 0) std::memcpy(values.data(), start, size * sizeof(double));
+    return status;
+}
+
+bool BinaryReader::read(std::vector<std::string>& values) {
+    std::uint64_t size = 0;
+    if (!read(size) || size > (data.size() - position) / sizeof(std::uint64_t)) {
+        status = false;
+        return false;
+    }
+    values.resize(size);
+    for (auto& value : values) {
+        if (!read(value)) return false;
+    }
+    return status;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace abase {
+
+    /// @class BoundedQueue
+    /// @brief Queue of limited size used to pass objects from a producer thread to a consumer thread.
+    /// @details `push` waits while the queue is full and `pop` waits while it is empty. Once the producer has
+    /// called `close`, `pop` returns the remaining objects and then returns false.
+    template<typename T>
+    class BoundedQueue {
+        private:
+            /// @brief queued objects
+            std::deque<T> items;
+            /// @brief maximal number of queued objects
+            std::size_t capacity;
+            /// @brief true when no more object will be pushed
+            bool closed = false;
+
+            /// @brief Mutex protecting the queue
+            std::mutex mutex;
+            /// @brief Condition used to wake up the producer when a place is available
+            std::condition_variable not_full;
+            /// @brief Condition used to wake up the consumer when an object is available
+            std::condition_variable not_empty;
+
+        public:
+            /// @brief Constructor
+            /// @param size maximal number of queued objects (at least 1)
+            explicit BoundedQueue(std::size_t size) : capacity(size > 0 ? size : 1) {};
+
+            BoundedQueue(const BoundedQueue&) = delete;
+            BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+            /// @brief Add an object at the end of the queue (wait while the queue is full)
+            /// @param item object to add
+            /// @return false if the queue is closed (the object is dropped)
+            bool push(T item) {
+                std::unique_lock<std::mutex> lock(mutex);
+                not_full.wait(lock, [this]() { return closed || items.size() < capacity; });
+                if (closed) return false;
+                items.push_back(std::move(item));
+                not_empty.notify_one();
+                return true;
+            }
+
+            /// @brief Take the object at the front of the queue (wait while the queue is empty and not closed)
+            /// @param[out] item object taken from the queue
+            /// @return false if the queue is closed and empty
+            bool pop(T& item) {
+                std::unique_lock<std::mutex> lock(mutex);
+                not_empty.wait(lock, [this]() { return closed || !items.empty(); });
+                if (items.empty()) return false;
+                item = std::move(items.front());
+                items.pop_front();
+                not_full.notify_one();
+                return true;
+            }
+
+            /// @brief Return true if the queue is closed
+            bool is_closed() {
+                std::lock_guard<std::mutex> lock(mutex);
+                return closed;
+            }
+
+            /// @brief Close the queue: no more object can be pushed, waiting threads are woken up
+            void close() {
+                std::lock_guard<std::mutex> lock(mutex);
+                closed = true;
+                not_full.notify_all();
+                not_empty.notify_all();
+            }
+    };
+
+}
@@ -6,6 +6,7 @@
 
 #include "Environment.h"
 #include "ErrorManager.h"
+#include "LineReader.h"
 #include "TranslationManager.h"
 #include "ConfigParser.h"
 
@@ -91,13 +92,15 @@ std::string ConfigParser::_convertValue_<std::string>(const std::string& value)
 void ConfigParser::loadFromFile(const std::string& filename) {
     std::lock_guard<std::mutex> lock(mutex);
     
-    std::ifstream file(filename);
+    LineReader file(filename);
     if (!file.is_open()) {
         error(translate("ERROR_OPEN_FILE",filename));
     }
 
+    std::string_view view;
     std::string line, key, value;
-    while (std::getline(file, line)) {
+    while (file.next(view)) {
+        line.assign(view);
         auto comment = line.find_first_of(COMMENT_DELIMITER);
         if (comment != std::string::npos) {
             line = line.substr(0, comment);
@@ -116,8 +119,6 @@ void ConfigParser::loadFromFile(const std::string& filename) {
             }
         }
     }
-
-    file.close();
 }
 
 void ConfigParser::setValue(const std::string& key, const std::string& value) {
@@ -67,6 +67,12 @@ namespace abase {
         /// @param key key string
         /// @param value value string
         void setValue(const std::string& key, const std::string& value);
+        /// @brief Check if a key is defined
+        /// @param key string key
+        /// @return true if a value is associated to the key
+        bool hasKey(const std::string& key) const {
+            return config_map.find(key) != config_map.end();
+        }
         /// @brief Get the number of key-value pairs
         int getKeyCount() const {
             return config_map.size();
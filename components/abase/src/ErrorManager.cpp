@@ -6,12 +6,22 @@
 
 using namespace abase;
 
+namespace {
+    /// @brief buffer of the deferred messages of the current thread
+    thread_local std::vector<DeferredMessage>* deferred_buffer = nullptr;
+}
+
 void ErrorManager::logMessage(const std::string& type, const std::string& message) {
     std::string msg = "[" + translate(type) + "] " + message;
     if (logger_) logger_->write(msg);
     std::cerr << msg << std::endl;
 }
 
+bool ErrorManager::defer(const std::string& type, const std::string& message) {
+    if (deferred_buffer == nullptr) return false;
+    deferred_buffer->push_back({type, message});
+    return true;
+}
 
 // Initialize the error manager with a logger
 void ErrorManager::init(std::shared_ptr<FileLogger> logger) {
@@ -20,12 +30,14 @@ void ErrorManager::init(std::shared_ptr<FileLogger> logger) {
 
 // Log an error message and terminate the program
 void ErrorManager::logError(const std::string& message) {
+    if (defer("ERROR", message)) throw DeferredError();
     logMessage("ERROR", message);
     std::exit(1);
 }
 
 // Log an input error message and terminate the program
 void ErrorManager::logInputError(const std::string& message) {
+    if (defer("INPUT_ERROR", message)) throw DeferredError();
     logMessage("INPUT_ERROR", message);
     std::exit(1);
 }
@@ -33,11 +45,31 @@ void ErrorManager::logInputError(const std::string& message) {
 // Log an file input error message and terminate the program
 void ErrorManager::logFileInputError(const std::string& message, const std::string& filecontext) {
     std::string msg = message + "\n" + filecontext;
+    if (defer("FILE_INPUT_ERROR", msg)) throw DeferredError();
     logMessage("FILE_INPUT_ERROR", msg);
     std::exit(1);
 }
 
+// Log an file input error message with a file context rendered only now
+void ErrorManager::logFileInputError(const std::string& message, const FileContext& filecontext) {
+    logFileInputError(message, filecontext.render());
+}
+
 // Log a warning message
 void ErrorManager::logWarning(const std::string& message) {
+    if (defer("WARNING", message)) return;
     logMessage("WARNING", message);
 }
+
+// Defer the messages of the current thread
+void ErrorManager::setDeferredBuffer(std::vector<DeferredMessage>* buffer) {
+    deferred_buffer = buffer;
+}
+
+// Log the deferred messages and terminate the program on the first error
+void ErrorManager::logDeferred(const std::vector<DeferredMessage>& messages) {
+    for (const auto& deferred : messages) {
+        logMessage(deferred.type, deferred.message);
+        if (deferred.type != "WARNING") std::exit(1);
+    }
+}
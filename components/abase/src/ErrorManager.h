@@ -1,11 +1,27 @@
 #pragma once
 
+#include <exception>
 #include <memory>
+#include <vector>
 
+#include "FileContext.h"
 #include "FileLogger.h"
 
 namespace abase {
 
+/// @brief Message kept by the ErrorManager while the messages of the calling thread are deferred
+struct DeferredMessage {
+    /// @brief type of message (ERROR, INPUT_ERROR, FILE_INPUT_ERROR or WARNING)
+    std::string type;
+    /// @brief output message (with the file context for a file input error)
+    std::string message;
+};
+
+/// @brief Exception raised instead of terminating the program when an error is deferred
+class DeferredError : public std::exception {
+    public:
+        const char* what() const noexcept override { return "deferred error"; }
+};
 
 /// @brief ErrorManager Class Definition
 class ErrorManager {
@@ -20,6 +36,11 @@ class ErrorManager {
         /// @param message output message 
         /// @warning No output message translation are done in this function.
         void logMessage(const std::string& type, const std::string& message);
+        /// @brief Keep the message if the messages of the calling thread are deferred
+        /// @param type type of message
+        /// @param message output message
+        /// @return true if the message is deferred
+        bool defer(const std::string& type, const std::string& message);
 
     public:
         /// @brief Get the instance of the ErrorManager (Singleton Pattern)
@@ -46,10 +67,23 @@ class ErrorManager {
         /// @brief Log an input error message and terminate the program
         /// @param message output message
         /// @param filecontext context of the file
-        void logFileInputError(const std::string& message, const std::string& filecontext);        
+        void logFileInputError(const std::string& message, const std::string& filecontext);
+        /// @brief Log an input error message and terminate the program
+        /// @param message output message
+        /// @param filecontext context of the file (rendered only here)
+        void logFileInputError(const std::string& message, const FileContext& filecontext);
         /// @brief Log an warning message and terminate the program
         /// @param message output message
         void logWarning(const std::string& message);
+
+        /// @brief Defer the messages of the calling thread. While a buffer is set, the messages are stored in the
+        /// buffer instead of being logged, and an error raises a `DeferredError` instead of terminating the program.
+        /// It allows concurrent tasks to report their messages in a deterministic order.
+        /// @param buffer buffer receiving the messages (nullptr to log the messages again)
+        void setDeferredBuffer(std::vector<DeferredMessage>* buffer);
+        /// @brief Log deferred messages in their order and terminate the program if one of them is an error
+        /// @param messages deferred messages
+        void logDeferred(const std::vector<DeferredMessage>& messages);
     };
 
 }
@@ -72,6 +106,13 @@ inline void file_input_error(const std::string message, const std::string fileco
     abase::ErrorManager::getInstance().logFileInputError(message, filecontext);
 }
 
+/// @brief Alias function for file input error output
+/// @param message output message
+/// @param filecontext context of the file
+inline void file_input_error(const std::string message, const abase::FileContext& filecontext) {
+    abase::ErrorManager::getInstance().logFileInputError(message, filecontext);
+}
+
 
 /// @brief Alias function for warning output
 /// @param message output message
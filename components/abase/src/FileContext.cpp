@@ -0,0 +1,46 @@
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
+#include "MappedFile.h"
+#include "TranslationManager.h"
+
+#include "FileContext.h"
+
+using namespace abase;
+
+namespace {
+    /// @brief Registered file: name and mapping of the file when it was read
+    struct RegisteredFile {
+        std::string filename;
+        std::shared_ptr<const MappedFile> mapping;
+    };
+
+    /// @brief Registered files indexed by identifier
+    std::deque<RegisteredFile> registered_files;
+    /// @brief Mutex protecting the registered files
+    std::mutex registered_files_mutex;
+}
+
+std::uint32_t FileContext::register_file(const std::string& filename, std::shared_ptr<const MappedFile> mapping) {
+    std::lock_guard<std::mutex> lock(registered_files_mutex);
+    if (registered_files.size() >= NO_FILE) throw std::overflow_error("Too many registered files");
+    registered_files.push_back({filename, std::move(mapping)});
+    return static_cast<std::uint32_t>(registered_files.size() - 1);
+}
+
+std::string FileContext::render() const {
+    RegisteredFile file;
+    {
+        std::lock_guard<std::mutex> lock(registered_files_mutex);
+        if (file_id < registered_files.size()) file = registered_files[file_id];
+    }
+
+    // the line is read again from the mapping of the file
+    std::string content = line;
+    if (offset != NO_OFFSET) {
+        content = file.mapping != nullptr ? std::string(file.mapping->line_at(offset)) : std::string();
+    }
+
+    return translate("ERROR_FILE_FOOTER", {file.filename, std::to_string(line_number), content});
+}
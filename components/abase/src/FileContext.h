@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace abase {
+
+    class MappedFile;
+
+    /// @class FileContext
+    /// @brief Position of a line in an input file, used to build the context of a file input error.
+    ///
+    /// A context is a small token (file identifier, line number, offset of the line in the file) that is cheap to
+    /// capture after each command. The message with the file name and the content of the line is only built by
+    /// `render` when an error occurs, from the mapping of the file kept by the registry (the line is displayed as it
+    /// was read, even if the file has been modified or removed since). For files that are not memory-mapped
+    /// (pipes, ...), the content of the line cannot be read again and a copy of the line is stored in the context.
+    class FileContext {
+        public:
+            /// @brief Identifier of an unknown file
+            static constexpr std::uint32_t NO_FILE = std::numeric_limits<std::uint32_t>::max();
+            /// @brief Offset of an undefined line
+            static constexpr std::size_t NO_OFFSET = std::numeric_limits<std::size_t>::max();
+
+        private:
+            /// @brief identifier of the file (see `register_file`)
+            std::uint32_t file_id = NO_FILE;
+            /// @brief line number displayed in the message
+            std::size_t line_number = 0;
+            /// @brief offset of the displayed line in the file
+            std::size_t offset = NO_OFFSET;
+            /// @brief copy of the displayed line (only used when the offset is undefined)
+            std::string line;
+
+        public:
+            FileContext() = default;
+            /// @brief Constructor for a line read again from the file when rendering
+            /// @param file file identifier
+            /// @param number line number displayed in the message
+            /// @param line_offset offset of the displayed line in the file (NO_OFFSET for an empty line)
+            FileContext(std::uint32_t file, std::size_t number, std::size_t line_offset)
+                : file_id(file), line_number(number), offset(line_offset) {};
+            /// @brief Constructor for a line copied in the context
+            /// @param file file identifier
+            /// @param number line number displayed in the message
+            /// @param line_copy content of the displayed line
+            FileContext(std::uint32_t file, std::size_t number, const std::string& line_copy)
+                : file_id(file), line_number(number), line(line_copy) {};
+
+            /// @brief Register a read file and return its identifier (thread-safe). Each reading of a file has its own
+            /// identifier, which indexes the registry.
+            /// @param filename name of the file
+            /// @param mapping mapping of the file, kept for the rendering (nullptr if the file is not mapped)
+            /// @return identifier of the file
+            static std::uint32_t register_file(const std::string& filename, std::shared_ptr<const MappedFile> mapping);
+
+            /// @brief Return the line number displayed in the message
+            std::size_t get_line_number() const { return line_number; }
+            /// @brief Build the context message (file name, line number and content of the line)
+            /// @return translated message
+            std::string render() const;
+    };
+
+}
@@ -1,5 +1,3 @@
-#include <regex>
-
 #include "Environment.h"
 #include "FileReader.h"
 
@@ -8,37 +6,48 @@ using namespace abase;
 //
 // FileLineFilter
 //
-std::string FileLineFilter::comment_regex(const std::string& delimiters) {
-    std::string regexStr = "["; 
-    for (char ch : delimiters) regexStr += char_regex(ch); 
-    regexStr += "].*"; 
-    return regexStr;
+std::vector<std::string> FileLineFilter::filter(const std::string& line) {
+    std::vector<std::string_view> words;
+    filter(line, words);
+    return std::vector<std::string>(words.begin(), words.end());
 }
 
-std::string FileLineFilter::range_regex(const std::string& delimiters) {
-    return "";
-}
+void FileLineFilter::filter(std::string_view line, std::vector<std::string_view>& words) {
+    words.clear();
 
-std::vector<std::string> FileLineFilter::filter(const std::string& line) {
-    // Suppress comments in the line
-    std::regex CommentRegex(comment_regex(COMMENT_DELIMITER));
-    std::string line_without_comments = std::regex_replace(line, CommentRegex, "");
-    line_without_comments = str::trim(line_without_comments);
-    if (line_without_comments.front() == '*') line_without_comments.erase(0, 1);
+    bool leading = true;
+    std::size_t pos = 0;
+    while (pos < line.size()) {
+        // a comment runs up to the end of the line (or to a carriage return)
+        std::size_t comment = line.find_first_of(COMMENT_DELIMITER, pos);
+        std::string_view segment = line.substr(pos, comment == std::string_view::npos ? line.npos : comment - pos);
 
-    return str::split(line_without_comments);
+        // suppress the leading marker '*'
+        if (leading) {
+            std::size_t first = segment.find_first_not_of(STRING_DELIMITER);
+            if (first != std::string_view::npos) {
+                leading = false;
+                segment.remove_prefix(first);
+                if (segment.front() == '*') segment.remove_prefix(1);
+            }
+        }
+        str::split_views(segment, words);
+
+        if (comment == std::string_view::npos) break;
+        pos = line.find_first_of("\r\n", comment);
+    }
 }
 
 //
 // FileReader
 //
 
-FileReader::FileReader(const std::string& input_name) : filename(input_name) {
-    input.open(input_name);
+FileReader::FileReader(const std::string& input_name) : filename(input_name), input(input_name) {
     if (!input.is_open()) {
         error(translate("ERROR_OPEN_FILE", input_name));
     }
     line_number = 0;
+    file_id = FileContext::register_file(input_name, input.get_mapping());
 }
 
 std::string FileReader::get_word() {
@@ -47,7 +56,7 @@ std::string FileReader::get_word() {
     // end of file
     if (buffer.empty()) return "";
     // standard case
-    return buffer[word_rk];
+    return std::string(buffer[word_rk]);
 }
                    
 void FileReader::move() {
@@ -61,24 +70,28 @@ void FileReader::move() {
  }
 
 void FileReader::buffer_update() {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    // clear buffer and line
-    prev_line = line;
+    // keep the previous line (the view on a buffered line is invalidated by the next reading)
+    if (input.is_mapped()) {
+        prev_line = line;
+    } else {
+        prev_storage.assign(line);
+        prev_line = prev_storage;
+    }
     buffer.clear();
-    line.clear();
+    line = std::string_view();
     
     // read next not empty line
-    while(std::getline(input, line)) {
+    while(input.next(line)) {
         line_number++;
-        buffer = FileLineFilter::filter(line);
+        FileLineFilter::filter(line, buffer);
         if (!buffer.empty()) break;
     }
     word_rk = 0;
 }
 
-std::string FileReader::context_error() const {
-    std::string expected_line = (word_rk == 0 ? prev_line : line );
-    std::string line_rk = (word_rk == 0 ? std::to_string(line_number - 1) : std::to_string(line_number));
-    return translate("ERROR_FILE_FOOTER", {filename, line_rk, expected_line});
+FileContext FileReader::context() const {
+    std::string_view expected_line = (word_rk == 0 ? prev_line : line);
+    std::size_t line_rk = (word_rk == 0 ? line_number - 1 : line_number);
+    if (input.is_mapped()) return FileContext(file_id, line_rk, input.offset_of(expected_line));
+    return FileContext(file_id, line_rk, std::string(expected_line));
 }
@@ -9,6 +9,7 @@ namespace abase {
 }
 
 void GlobalTimer::start(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     auto& timer = timers[name];
     if (timer.running) {
         throw std::runtime_error("Timer " + name + " already running");
@@ -19,6 +20,7 @@ void GlobalTimer::start(const std::string& name) {
 }
 
 void GlobalTimer::stop(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     auto it = timers.find(name);
     if (it == timers.end() || !it->second.running) {
         throw std::runtime_error("Timer " + name + " not running");
@@ -31,12 +33,14 @@ void GlobalTimer::stop(const std::string& name) {
 }
 
 void GlobalTimer::stop_all() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     for (auto& timer : timers) {
         if (timer.second.running) stop(timer.first);
     }
 }
 
 double GlobalTimer::getWallTime(const std::string& name) const {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     auto it = timers.find(name);
     if (it == timers.end()) {
         return 0.0;
@@ -45,6 +49,7 @@ double GlobalTimer::getWallTime(const std::string& name) const {
 }
 
 double GlobalTimer::getCPUTime(const std::string& name) const {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     auto it = timers.find(name);
     if (it == timers.end()) {
         return 0.0;
@@ -53,6 +58,7 @@ double GlobalTimer::getCPUTime(const std::string& name) const {
 }
 
 void GlobalTimer::print(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     auto it = timers.find(name);
     if (it == timers.end()) {
         return;
@@ -66,6 +72,7 @@ void GlobalTimer::print(const std::string& name) {
 }
 
 void GlobalTimer::reset(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     auto it = timers.find(name);
     if (it != timers.end()) {
         it->second = TimerData{};
@@ -73,16 +80,19 @@ void GlobalTimer::reset(const std::string& name) {
 }
 
 void GlobalTimer::resetAll() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     timers.clear();
 }
 
 std::pair<std::string, std::string> GlobalTimer::get_timer(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     std::string cpu_time = str::to_string(getCPUTime(name), abase::TIME_PRECISION);
     std::string wall_time = str::to_string(getWallTime(name), abase::TIME_PRECISION);
     return std::make_pair(cpu_time, wall_time);
 }
 
 std::unordered_map<std::string, std::pair<std::string, std::string>> GlobalTimer::get_all_timers() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     std::unordered_map<std::string, std::pair<std::string, std::string>> result;
     for (const auto& timer : timers) {
         result[timer.first] = get_timer(timer.first);
@@ -3,6 +3,8 @@
 #include <chrono>
 #include <unordered_map>
 #include <limits>
+#include <mutex>
+#include <stdexcept>
 
 #include "String.h"
 
@@ -13,6 +15,7 @@ namespace abase {
 
     /// @class GlobalTimer
     /// @brief A class to manage and measure wall-clock and CPU time for named timers.
+    /// @details The timers can be started and stopped from several threads (a given timer must not be started twice).
     class GlobalTimer {
     private:
         using WallClock = std::chrono::high_resolution_clock;
@@ -28,6 +31,7 @@ namespace abase {
         };
 
         std::unordered_map<std::string, TimerData> timers; ///< A map of timer names to their data.
+        mutable std::recursive_mutex mutex; ///< Protects the map of timers.
 
     public:
         /// @brief Starts the timer with the given name.
@@ -71,6 +75,29 @@ namespace abase {
     /// @brief Global instance of GlobalTimer.
     extern GlobalTimer globalTimer;
 
+    /// @class ScopedTimer
+    /// @brief Timer of the global instance running for the lifetime of the object: the timer is stopped even if the
+    /// scope is left by an exception, so that it can be started again.
+    class ScopedTimer {
+    private:
+        std::string name; ///< The name of the timer.
+
+    public:
+        /// @brief Starts the timer with the given name.
+        /// @param name The name of the timer to start.
+        explicit ScopedTimer(const std::string& name) : name(name) { globalTimer.start(name); }
+        /// @brief Stops the timer (unless it has already been stopped, e.g. by stop_all).
+        ~ScopedTimer() {
+            try {
+                globalTimer.stop(name);
+            } catch (const std::runtime_error&) {
+            }
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+    };
+
 } // namespace abase
 
 
@@ -0,0 +1,73 @@
+#include <cstring>
+#include <limits>
+#include <sys/mman.h>
+
+#include "LineReader.h"
+
+using namespace abase;
+
+LineReader::LineReader(const std::string& input_name) : filename(input_name) {
+    if (map_file()) {
+        opened = true;
+        return;
+    }
+
+    // buffered reading for pipes and special files
+    input.open(input_name);
+    opened = input.is_open();
+}
+
+bool LineReader::next(std::string_view& line) {
+    if (!mapped) {
+        bool status = static_cast<bool>(std::getline(input, storage));
+        line = storage;
+        if (status) nb_lines++;
+        return status;
+    }
+
+    // as std::getline, the line is kept after an unterminated last line
+    if (offset >= size) {
+        if (offset == size) line = std::string_view();
+        return false;
+    }
+
+    const char* start = data + offset;
+    const char* end = static_cast<const char*>(std::memchr(start, '\n', size - offset));
+    std::size_t length = (end == nullptr) ? size - offset : static_cast<std::size_t>(end - start);
+
+    line = std::string_view(start, length);
+    offsets.push_back(offset);
+    offset += length + 1;
+    nb_lines++;
+    return true;
+}
+
+std::size_t LineReader::offset_of(std::string_view line) const {
+    if (!mapped || line.data() < data || line.data() >= data + size) return std::numeric_limits<std::size_t>::max();
+    return static_cast<std::size_t>(line.data() - data);
+}
+
+std::string_view LineReader::get_line(std::size_t number) const {
+    if (!mapped || number == 0 || number > offsets.size()) return std::string_view();
+
+    std::size_t start = offsets[number - 1];
+    std::size_t end = (number < offsets.size()) ? offsets[number] - 1 : offset - 1;
+    return std::string_view(data + start, end - start);
+}
+
+//
+// Private functions
+//
+
+bool LineReader::map_file() {
+    auto file = std::make_shared<const MappedFile>(filename);
+    if (!file->is_mapped()) return false;
+
+    std::string_view content = file->content();
+    if (!content.empty()) ::madvise(const_cast<char*>(content.data()), content.size(), MADV_SEQUENTIAL);
+    mapping = file;
+    data = content.data();
+    size = content.size();
+    mapped = true;
+    return true;
+}
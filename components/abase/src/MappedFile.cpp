@@ -0,0 +1,46 @@
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MappedFile.h"
+
+using namespace abase;
+
+MappedFile::MappedFile(const std::string& filename) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return;
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode)) {
+        ::close(fd);
+        return;
+    }
+
+    // empty regular file: nothing to map
+    if (status.st_size > 0) {
+        void* ptr = ::mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED) {
+            ::close(fd);
+            return;
+        }
+        data = static_cast<const char*>(ptr);
+        size = static_cast<std::size_t>(status.st_size);
+    }
+
+    // the mapping stays valid once the file is closed
+    ::close(fd);
+    mapped = true;
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) ::munmap(const_cast<char*>(data), size);
+}
+
+std::string_view MappedFile::line_at(std::size_t offset) const {
+    if (offset >= size) return std::string_view();
+    const char* start = data + offset;
+    const char* end = static_cast<const char*>(std::memchr(start, '\n', size - offset));
+    return std::string_view(start, (end == nullptr) ? size - offset : static_cast<std::size_t>(end - start));
+}
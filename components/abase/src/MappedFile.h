@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace abase {
+
+    /// @class MappedFile
+    /// @brief Read-only memory mapping of a whole regular file.
+    ///
+    /// The pages of the mapping are shared by all the processes mapping the same file. A mapping shared by a line
+    /// reader and the error contexts (see \ref FileContext) keeps the content of an input file available after the
+    /// reading, even if the file has been removed or replaced since.
+    class MappedFile {
+        private:
+            /// @brief start of the mapping (nullptr for an empty or unmapped file)
+            const char* data = nullptr;
+            /// @brief size of the mapping
+            std::size_t size = 0;
+            /// @brief true if the file is mapped
+            bool mapped = false;
+
+        public:
+            /// @brief Constructor
+            /// @param filename name of the file to map
+            explicit MappedFile(const std::string& filename);
+            /// @brief Destructor (release the mapping)
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            /// @brief Return true if the file is mapped (false if it does not exist or is not a regular file)
+            bool is_mapped() const { return mapped; }
+            /// @brief Return a view on the content of the file (valid as long as the object exists)
+            std::string_view content() const { return std::string_view(data, size); }
+            /// @brief Return the line starting at an offset (without the end of line character)
+            /// @param offset offset of the line
+            /// @return view on the line (empty view for an offset out of the file)
+            std::string_view line_at(std::size_t offset) const;
+    };
+
+}
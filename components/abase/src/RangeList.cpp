@@ -0,0 +1,136 @@
+#include <algorithm>
+
+#include "RangeList.h"
+
+using namespace abase;
+
+RangeList::RangeList(const std::vector<std::size_t>& values) {
+    for (const auto& value : values) push_back(value);
+}
+
+void RangeList::clear() {
+    runs.clear();
+    offsets.clear();
+    count = 0;
+    increasing = true;
+}
+
+void RangeList::push_back(std::size_t value) {
+    if (!runs.empty()) {
+        Run& run = runs.back();
+        if (value <= run.last) increasing = false;
+
+        // a single value becomes the first value of a progression
+        if (run.first == run.last && value > run.last) {
+            run.step = value - run.first;
+            run.last = value;
+            count++;
+            return;
+        }
+
+        // next value of the progression
+        if (run.first < run.last && value > run.last && value - run.last == run.step) {
+            run.last = value;
+            count++;
+            return;
+        }
+    }
+    add_run({value, value, 1});
+}
+
+void RangeList::add_range(std::size_t first, std::size_t bound, std::size_t step) {
+    if (step == 0 || first > bound) return;
+    std::size_t last = first + (bound - first) / step * step;
+    if (first == last) {
+        push_back(first);
+        return;
+    }
+
+    if (!runs.empty()) {
+        Run& run = runs.back();
+        if (first <= run.last) increasing = false;
+
+        // continuation of the last progression
+        bool same_step = (run.first == run.last || run.step == step);
+        if (same_step && run.first <= run.last && first > run.last && first - run.last == step) {
+            count += (last - first) / step + 1;
+            run.step = step;
+            run.last = last;
+            return;
+        }
+    }
+    add_run({first, last, step});
+}
+
+void RangeList::shift(std::ptrdiff_t offset) {
+    std::size_t delta = static_cast<std::size_t>(offset);
+    if (delta == 0) return;
+
+    // the values lower than the threshold and the other ones are shifted to two separate intervals (wrap-around):
+    // a run containing both is split, so that each shifted run stays increasing
+    std::size_t threshold = std::size_t(0) - delta;
+    std::vector<Run> shifted;
+    shifted.reserve(runs.size());
+    for (const auto& run : runs) {
+        if (run.first < threshold && run.last >= threshold) {
+            std::size_t last_below = run.first + (threshold - 1 - run.first) / run.step * run.step;
+            shifted.push_back({run.first + delta, last_below + delta, run.step});
+            shifted.push_back({last_below + run.step + delta, run.last + delta, run.step});
+        } else {
+            shifted.push_back({run.first + delta, run.last + delta, run.step});
+        }
+    }
+
+    runs.clear();
+    offsets.clear();
+    count = 0;
+    for (const auto& run : shifted) add_run(run);
+    update_order();
+}
+
+std::size_t RangeList::operator[](std::size_t rank) const {
+    std::size_t run = static_cast<std::size_t>(std::upper_bound(offsets.begin(), offsets.end(), rank) - offsets.begin());
+    run--;
+    return runs[run].first + (rank - offsets[run]) * runs[run].step;
+}
+
+std::size_t RangeList::max() const {
+    std::size_t max_value = 0;
+    for (const auto& run : runs) {
+        max_value = std::max({max_value, run.first, run.last});
+    }
+    return max_value;
+}
+
+std::size_t RangeList::nb_distinct() const {
+    if (increasing) return count;
+
+    std::vector<std::size_t> values = to_vector();
+    std::sort(values.begin(), values.end());
+    return static_cast<std::size_t>(std::unique(values.begin(), values.end()) - values.begin());
+}
+
+std::vector<std::size_t> RangeList::to_vector() const {
+    std::vector<std::size_t> values;
+    values.reserve(count);
+    values.insert(values.end(), begin(), end());
+    return values;
+}
+
+//
+// Private functions
+//
+
+void RangeList::add_run(const Run& run) {
+    runs.push_back(run);
+    offsets.push_back(count);
+    count += run.size();
+}
+
+void RangeList::update_order() {
+    increasing = true;
+    for (std::size_t i = 0; i < runs.size(); ++i) {
+        if (runs[i].first > runs[i].last) increasing = false;
+        if (i > 0 && runs[i].first <= runs[i - 1].last) increasing = false;
+    }
+}
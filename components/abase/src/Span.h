@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+
+namespace abase {
+
+    /// @class Span
+    /// @brief View on a contiguous sequence of values owned by another object (no copy of the values).
+    ///
+    /// The view is only valid as long as the owner of the values is alive and not modified.
+    template<typename T>
+    class Span {
+        private:
+            /// @brief first value
+            T* first = nullptr;
+            /// @brief number of values
+            std::size_t count = 0;
+
+        public:
+            Span() = default;
+            /// @brief Constructor
+            /// @param data first value
+            /// @param size number of values
+            Span(T* data, std::size_t size) : first(data), count(size) {};
+            /// @brief Constructor from a contiguous container (vector, ...)
+            /// @param values container of the values
+            template<typename Container>
+            Span(Container& values) : first(values.data()), count(values.size()) {};
+
+            /// @brief Return a pointer to the first value
+            T* data() const { return first; }
+            /// @brief Return the number of values
+            std::size_t size() const { return count; }
+            /// @brief Return true if the view has no value
+            bool empty() const { return count == 0; }
+            /// @brief Return a value by its rank
+            T& operator[](std::size_t rank) const { return first[rank]; }
+
+            T* begin() const { return first; }
+            T* end() const { return first + count; }
+    };
+
+}
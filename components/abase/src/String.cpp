@@ -1,6 +1,10 @@
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iomanip>
-#include <regex>
 #include <sstream>
 
 #include "Environment.h"
@@ -29,25 +33,50 @@ std::string str::uppercase(const std::string& str) {
     return result;
 }
 
+namespace {
+    /// @brief Check if a character is a space (same definition as the `\s` regex class)
+    inline bool is_space(char ch) {
+        return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+    }
+    /// @brief Check if a character is a quotation mark
+    inline bool is_quote(char ch) {
+        return std::strchr(QUOTATION_DELIMITER, ch) != nullptr && ch != '\0';
+    }
+}
+
 std::vector<std::string> str::split(const std::string& str) {
-    std::string trimmed = str::trim(str);
-
-    // Regex expression to split the line into words
-    std::regex SplitRegex(R"((["'][^"']*["'])|(\S+))");
-    auto wordsBegin = std::sregex_iterator(trimmed.begin(), trimmed.end(), SplitRegex);
-    auto wordsEnd = std::sregex_iterator();
-
-    // Process each word
-    std::vector<std::string> result;
-    for (auto it = wordsBegin; it != wordsEnd; ++it) {
-        std::string word = it->str();
-        // Remove leading and trailing quotes
-        if (word.front() == '"' || word.front() == '\'') word.erase(0, 1);
-        if (word.back() == '"' || word.back() == '\'') word.pop_back();
-
-        if (!word.empty()) result.push_back(word);        
+    std::vector<std::string_view> words;
+    split_views(str, words);
+    return std::vector<std::string>(words.begin(), words.end());
+}
+
+void str::split_views(std::string_view str, std::vector<std::string_view>& words) {
+    std::size_t n = str.size();
+    std::size_t i = 0;
+    while (i < n) {
+        if (is_space(str[i])) { i++; continue; }
+
+        // quoted word up to the next quotation mark, otherwise a sequence of non-space characters
+        std::size_t end = i;
+        bool quoted = false;
+        if (is_quote(str[i])) {
+            std::size_t j = i + 1;
+            while (j < n && !is_quote(str[j])) j++;
+            quoted = (j < n);
+            if (quoted) end = j + 1;
+        }
+        if (!quoted) {
+            while (end < n && !is_space(str[end])) end++;
+        }
+
+        // remove leading and trailing quotes
+        std::string_view word = str.substr(i, end - i);
+        if (!word.empty() && is_quote(word.front())) word.remove_prefix(1);
+        if (!word.empty() && is_quote(word.back())) word.remove_suffix(1);
+        if (!word.empty()) words.push_back(word);
+
+        i = end;
     }
-    return result;
 }
 
 std::string str::replace(const std::string& str, const std::string& from, const std::string& to, std::size_t n) {
@@ -63,6 +92,111 @@ std::string str::replace(const std::string& str, const std::string& from, const
     return result;
 }
 
+namespace {
+    /// @brief Read a real number with a Fortran exponent (`D` or `d` instead of `E`)
+    /// @param word the word to read (without plus sign)
+    /// @param length number of characters read before the exponent character
+    /// @param[out] value number read
+    /// @return result of the conversion of the word where the exponent character is replaced by `E` (invalid 
+    /// argument if no Fortran exponent follows)
+    std::from_chars_result parse_fortran_exponent(std::string_view word, std::size_t length, double& value) {
+        std::from_chars_result result{word.data() + length, std::errc::invalid_argument};
+        if (length >= word.size() || (word[length] != 'D' && word[length] != 'd')) return result;
+
+        std::string copy(word);
+        copy[length] = 'E';
+        result = std::from_chars(copy.data(), copy.data() + copy.size(), value);
+        result.ptr = word.data() + (result.ptr - copy.data());
+        if (result.ec == std::errc() && result.ptr <= word.data() + length + 1) result.ec = std::errc::invalid_argument;
+        return result;
+    }
+
+    /// @brief Read the number written at the start of a word (see `str::parse_number`)
+    /// @param word the word to read
+    /// @param[out] value number read (unchanged if no number is read)
+    /// @param[out] error conversion error
+    /// @return number of characters read
+    template<typename T>
+    std::size_t parse_chars(std::string_view word, T& value, std::errc& error) {
+        // std::from_chars does not accept the plus sign
+        std::size_t start = 0;
+        if (!word.empty() && word[0] == '+') {
+            start = 1;
+            if (word.size() > 1 && (word[1] == '+' || word[1] == '-')) {
+                error = std::errc::invalid_argument;
+                return 0;
+            }
+        }
+        std::string_view number_word = word.substr(start);
+        const char* first = number_word.data();
+        const char* last = first + number_word.size();
+
+        T number;
+        std::from_chars_result result;
+        if constexpr (std::is_floating_point_v<T>) {
+            result = std::from_chars(first, last, number);
+            if (result.ec == std::errc()) {
+                // the exponent may be a Fortran one
+                double fortran_number;
+                auto fortran = parse_fortran_exponent(number_word, result.ptr - first, fortran_number);
+                if (fortran.ec != std::errc::invalid_argument) result = fortran;
+                if (fortran.ec == std::errc()) number = fortran_number;
+            }
+        } else if constexpr (std::is_unsigned_v<T>) {
+            // negative values are wrapped as for std::stoull
+            bool negative = (start == 0 && !word.empty() && word[0] == '-');
+            result = std::from_chars(negative ? first + 1 : first, last, number);
+            if (negative) number = T(0) - number;
+        } else {
+            result = std::from_chars(first, last, number);
+        }
+
+        error = result.ec;
+        if (result.ec == std::errc()) value = number;
+        return static_cast<std::size_t>(result.ptr - word.data());
+    }
+}
+
+template<typename T>
+std::size_t str::parse_number(std::string_view word, T& value) {
+    std::errc error;
+    std::size_t read = parse_chars(word, value, error);
+    return (error == std::errc()) ? read : 0;
+}
+
+template<typename T>
+bool str::to_number(std::string_view word, T& value) {
+    // the stream extraction only accepts a decimal notation
+    std::size_t start = (!word.empty() && (word[0] == '+' || word[0] == '-')) ? 1 : 0;
+    if (start >= word.size()) return false;
+    unsigned char first = static_cast<unsigned char>(word[start]);
+    if (!std::isdigit(first) && !(std::is_floating_point_v<T> && first == '.')) return false;
+
+    std::errc error;
+    std::size_t read = parse_chars(word, value, error);
+    if (read != word.size()) return false;
+
+    // the stream extraction gives zero for an underflow of a real number
+    if constexpr (std::is_floating_point_v<T>) {
+        if (error == std::errc::result_out_of_range) {
+            std::string copy(word);
+            for (auto& ch : copy) if (ch == 'D' || ch == 'd') ch = 'E';
+            T number = static_cast<T>(std::strtod(copy.c_str(), nullptr));
+            if (std::abs(number) == HUGE_VAL) return false;
+            value = number;
+            return true;
+        }
+    }
+    return error == std::errc();
+}
+
+template std::size_t str::parse_number<int>(std::string_view word, int& value);
+template std::size_t str::parse_number<std::size_t>(std::string_view word, std::size_t& value);
+template std::size_t str::parse_number<double>(std::string_view word, double& value);
+template bool str::to_number<int>(std::string_view word, int& value);
+template bool str::to_number<std::size_t>(std::string_view word, std::size_t& value);
+template bool str::to_number<double>(std::string_view word, double& value);
+
 std::string str::to_string(const double value, const std::size_t precision) {
     std::size_t p = precision;
     if (precision == UNSET_STRING_PRECISION) {
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include "GlobalTimer.h"
+#include "TaskGraph.h"
+
+using namespace abase;
+
+namespace {
+    /// @brief Return the wave of each task (a task is executed after the waves of its dependencies)
+    template<typename Tasks>
+    std::vector<std::size_t> task_waves(const Tasks& tasks) {
+        std::vector<std::size_t> waves(tasks.size(), 0);
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            for (std::size_t dep : tasks[i].dependencies) waves[i] = std::max(waves[i], waves[dep] + 1);
+        }
+        return waves;
+    }
+}
+
+void TaskGraph::add(const std::string& name, std::function<void()> function,
+                    const std::vector<std::string>& dependencies) {
+    Task task;
+    task.name = name;
+    task.function = std::move(function);
+    for (const auto& dep : dependencies) {
+        auto it = std::find_if(tasks.begin(), tasks.end(), [&dep](const Task& t) { return t.name == dep; });
+        if (it == tasks.end()) throw std::invalid_argument("Unknown task dependency " + dep + " of " + name);
+        task.dependencies.push_back(static_cast<std::size_t>(it - tasks.begin()));
+    }
+    tasks.push_back(std::move(task));
+}
+
+std::size_t TaskGraph::width() const {
+    std::vector<std::size_t> waves = task_waves(tasks);
+    std::vector<std::size_t> counts(tasks.size() + 1, 0);
+    for (std::size_t wave : waves) ++counts[wave];
+    return tasks.empty() ? 0 : *std::max_element(counts.begin(), counts.end());
+}
+
+void TaskGraph::execute(Task& task) {
+    ErrorManager& manager = ErrorManager::getInstance();
+    manager.setDeferredBuffer(&task.messages);
+    start_timer(task.name);
+    try {
+        task.function();
+    } catch (const DeferredError&) {
+        task.failed = true;
+    } catch (...) {
+        task.failed = true;
+        task.exception = std::current_exception();
+    }
+    stop_timer(task.name);
+    manager.setDeferredBuffer(nullptr);
+    task.done = true;
+}
+
+void TaskGraph::run(ThreadPool& pool) {
+    std::vector<std::size_t> waves = task_waves(tasks);
+    std::size_t nb_waves = tasks.empty() ? 0 : *std::max_element(waves.begin(), waves.end()) + 1;
+
+    bool failed = false;
+    for (std::size_t wave = 0; wave < nb_waves && !failed; ++wave) {
+        std::vector<std::function<void()>> batch;
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            if (waves[i] == wave) batch.push_back([this, i]() { execute(tasks[i]); });
+        }
+        pool.run(batch);
+        for (const auto& task : tasks) failed = failed || task.failed;
+    }
+
+    // report the messages in the order of the tasks
+    for (const auto& task : tasks) {
+        if (!task.done) continue;
+        ErrorManager::getInstance().logDeferred(task.messages);
+        if (task.exception) std::rethrow_exception(task.exception);
+    }
+}
+
+void TaskGraph::run() {
+    std::size_t nb_threads = std::min<std::size_t>(width(), std::max(1U, std::thread::hardware_concurrency()));
+    ThreadPool pool;
+    pool.resize(nb_threads);
+    run(pool);
+}
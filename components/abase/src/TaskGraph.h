@@ -0,0 +1,62 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "ErrorManager.h"
+#include "ThreadPool.h"
+
+namespace abase {
+
+    /// @class TaskGraph
+    /// @brief Set of named tasks with dependencies, executed concurrently on a thread pool.
+    /// @details The tasks are executed by waves: a wave contains all the tasks whose dependencies are completed.
+    /// Each task is measured by its own timer (named after the task) and its messages (errors and warnings) are
+    /// deferred while the tasks run. They are logged once the execution stops, in the order in which the tasks have
+    /// been added, so that the output does not depend on the scheduling. When a task fails, the current wave is
+    /// completed and the tasks of the following waves are not executed.
+    class TaskGraph {
+        private:
+            /// @brief Task of the graph
+            struct Task {
+                std::string name;
+                std::function<void()> function;
+                std::vector<std::size_t> dependencies;
+                /// @brief messages raised by the task
+                std::vector<DeferredMessage> messages;
+                /// @brief exception raised by the task (other than a deferred error)
+                std::exception_ptr exception = nullptr;
+                bool done = false;
+                bool failed = false;
+            };
+
+            std::vector<Task> tasks;
+
+            /// @brief Execute a task with its timer and the deferred messages
+            /// @param task task to execute
+            static void execute(Task& task);
+
+        public:
+            TaskGraph() = default;
+
+            /// @brief Add a task
+            /// @param name name of the task (also used for its timer)
+            /// @param function function executed by the task
+            /// @param dependencies names of the tasks which must be completed before this one (already added)
+            void add(const std::string& name, std::function<void()> function,
+                     const std::vector<std::string>& dependencies = {});
+
+            /// @brief Return the largest number of tasks which can be executed at the same time
+            std::size_t width() const;
+
+            /// @brief Execute the tasks and log their messages. The program is terminated on the first error (in
+            /// the order of the tasks) and the first other exception is rethrown.
+            /// @param pool thread pool executing the tasks
+            void run(ThreadPool& pool);
+            /// @brief Execute the tasks on a temporary thread pool sized to the width of the graph (used before the
+            /// number of threads of the computation is known)
+            void run();
+    };
+
+}
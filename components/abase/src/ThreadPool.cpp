@@ -0,0 +1,162 @@
+#include "ConfigParser.h"
+#include "ThreadPool.h"
+
+using namespace abase;
+
+namespace abase {
+    ThreadPool globalThreadPool;
+}
+
+namespace {
+    /// @brief pool owning the current thread
+    thread_local const ThreadPool* current_pool = nullptr;
+    /// @brief rank of the current thread in its pool
+    thread_local std::size_t current_rank = 0;
+}
+
+ThreadPool::~ThreadPool() {
+    stop();
+}
+
+void ThreadPool::resize(std::size_t nb_threads) {
+    if (nb_threads == workers.size() || (nb_threads < 2 && workers.empty())) return;
+    stop();
+    if (nb_threads > 1) start(nb_threads);
+}
+
+bool ThreadPool::in_worker() {
+    return current_pool != nullptr;
+}
+
+std::size_t ThreadPool::worker_rank() {
+    return current_rank;
+}
+
+void ThreadPool::run(std::vector<std::function<void()>>& tasks) {
+    if (tasks.empty()) return;
+
+    // sequential execution in the calling thread
+    if (workers.empty() || current_pool == this) {
+        for (auto& task : tasks) task();
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(run_mutex);
+    {
+        std::lock_guard<std::mutex> lock(batch_mutex);
+        first_error = nullptr;
+        pending = tasks.size();
+    }
+
+    // round-robin distribution to keep the largest tasks at the front of each queue. A task is counted under the
+    // lock of its queue, before any worker can take it (and decrement the counter).
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        auto& queue = *queues[i % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(tasks[i]));
+        ++queued;
+    }
+    {
+        // a worker checking its wait condition holds the batch mutex: it waits before the notification
+        std::lock_guard<std::mutex> lock(batch_mutex);
+    }
+    batch_cv.notify_all();
+
+    std::exception_ptr error_ptr = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(batch_mutex);
+        done_cv.wait(lock, [this]() { return pending == 0; });
+        error_ptr = first_error;
+        first_error = nullptr;
+    }
+    tasks.clear();
+
+    if (error_ptr) std::rethrow_exception(error_ptr);
+}
+
+//
+// Private functions
+//
+
+void ThreadPool::start(std::size_t nb_threads) {
+    stopping = false;
+    for (std::size_t i = 0; i < nb_threads; ++i) queues.push_back(std::make_unique<WorkerQueue>());
+    for (std::size_t i = 0; i < nb_threads; ++i) workers.emplace_back(&ThreadPool::worker_loop, this, i);
+}
+
+void ThreadPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(batch_mutex);
+        stopping = true;
+    }
+    batch_cv.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+    workers.clear();
+    queues.clear();
+}
+
+void ThreadPool::worker_loop(std::size_t worker) {
+    current_pool = this;
+    current_rank = worker;
+    std::function<void()> task;
+
+    while (true) {
+        if (pop_local(worker, task) || steal(worker, task)) {
+            queued--;
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(batch_mutex);
+        batch_cv.wait(lock, [this]() { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+    }
+}
+
+bool ThreadPool::pop_local(std::size_t worker, std::function<void()>& task) {
+    auto& queue = *queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t worker, std::function<void()>& task) {
+    for (std::size_t i = 1; i < queues.size(); ++i) {
+        auto& queue = *queues[(worker + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::execute(std::function<void()>& task) {
+    std::exception_ptr error_ptr = nullptr;
+    try {
+        task();
+    } catch (...) {
+        error_ptr = std::current_exception();
+    }
+    task = nullptr;
+
+    std::lock_guard<std::mutex> lock(batch_mutex);
+    if (error_ptr && !first_error) first_error = error_ptr;
+    if (--pending == 0) done_cv.notify_all();
+}
+
+//
+// Configuration
+//
+
+std::size_t abase::requested_nb_threads() {
+    if (!globalConfigParser.hasKey("--multi")) return 1;
+    int nb_threads = globalConfigParser.getValue<int>("--multi");
+    if (nb_threads < 1) return 1;
+    return static_cast<std::size_t>(nb_threads);
+}
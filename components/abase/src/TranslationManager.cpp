@@ -80,6 +80,14 @@ void TranslationManager::loadAllTranslations(const std::string& directory) {
     }
 }
 
+void TranslationManager::merge(const TranslationManager& other) {
+    for (const auto& translation : other.translations) {
+        if (!translations.insert(translation).second) {
+            throw std::invalid_argument("The key " + translation.first + " is already defined !");
+        }
+    }
+}
+
 void TranslationManager::setCurrentLanguage(const std::string& langCode) {
     currentLanguage = langCode;
 }
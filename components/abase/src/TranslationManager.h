@@ -43,6 +43,9 @@ namespace abase {
             /// @brief Complete the translation dictionnary from all YAML files contained in a directory
             /// @param directory where all YAML files are stored
             void loadAllTranslations(const std::string& directory);
+            /// @brief Add the translations of another manager (the keys must not be already defined)
+            /// @param other manager whose translations are added
+            void merge(const TranslationManager& other);
 
             /// @brief Set the output language
             /// @param langCode the output language
@@ -8,7 +8,7 @@ std::shared_ptr<BaseMaterial> BaseMaterialCollector::create_material(const std::
     return nullptr;
 }
 
-void BaseMaterialCollector::set_data(const std::shared_ptr<abase::BaseCommand>& command, const std::string& filecontext) {
+void BaseMaterialCollector::set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext) {
     std::string name = command->get_name();
 
     // create the material object
@@ -22,22 +22,41 @@ void BaseMaterialCollector::set_data(const std::shared_ptr<abase::BaseCommand>&
     new_material->verify(filecontext);
 
     // check if the material already exists
-    for (const auto& material : materials) {
-        if (material->material_id == new_material->material_id) {
-            std::string msg = translate("MATERIAL_CONFLICT", new_material->material_id);
-            file_input_error(msg, filecontext);
-        }
+    if (material_index.find(new_material->material_id) != material_index.end()) {
+        std::string msg = translate("MATERIAL_CONFLICT", new_material->material_id);
+        file_input_error(msg, filecontext);
     }
 
     // add the material to the collection
+    material_index.emplace(new_material->material_id, materials.size());
     materials.push_back(new_material);
 }
 
 std::shared_ptr<BaseMaterial> BaseMaterialCollector::get_material(const std::string& material_id) const {
+    auto it = material_index.find(material_id);
+    return it != material_index.end() ? materials[it->second] : nullptr;
+}
+
+void BaseMaterialCollector::save(abase::BinaryWriter& writer) const {
+    writer.write(static_cast<std::uint64_t>(materials.size()));
     for (const auto& material : materials) {
-        if (material->material_id == material_id) {
-            return material;
-        }
+        writer.write(material->get_type());
+        material->save(writer);
     }
-    return nullptr;
+}
+
+bool BaseMaterialCollector::load(abase::BinaryReader& reader) {
+    clear();
+    std::uint64_t count = 0;
+    reader.read(count);
+    for (std::uint64_t i = 0; i < count && reader.good(); ++i) {
+        std::string type;
+        reader.read(type);
+        std::shared_ptr<BaseMaterial> material = create_material(type);
+        if (material == nullptr) return false;
+        material->load(reader);
+        material_index.emplace(material->material_id, materials.size());
+        materials.push_back(material);
+    }
+    return reader.good();
 }
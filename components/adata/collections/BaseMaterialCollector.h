@@ -17,11 +17,14 @@ namespace adata {
             /// @return material object
             std::shared_ptr<BaseMaterial> create_material(const std::string& type) const;
 
+            /// @brief rank of each material by material_id
+            std::unordered_map<std::string, std::size_t> material_index;
+
         protected:
             /// @brief Convert read data from input file into data objects
             /// @param command read data from the input file
             /// @param filecontext file context
-            void set_data(const std::shared_ptr<abase::BaseCommand>& command, const std::string& filecontext);
+            void set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext);
 
             /// @brief Collection of materials
             std::vector<std::shared_ptr<BaseMaterial>> materials;
@@ -36,8 +39,16 @@ namespace adata {
             /// @return shared pointer to the material
             std::shared_ptr<BaseMaterial> get_material(const std::string& material_id) const;
 
+            /// @brief Write the collection in a binary snapshot
+            /// @param writer binary writer
+            void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the collection from a binary snapshot
+            /// @param reader binary reader
+            /// @return false if the snapshot is corrupted
+            bool load(abase::BinaryReader& reader);
+
             /// @brief Clear the collection of materials
-            void clear() { materials.clear(); }
+            void clear() { materials.clear(); material_index.clear(); }
     };
 
 }
\ No newline at end of file
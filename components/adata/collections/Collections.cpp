@@ -1,44 +1,148 @@
+#include <filesystem>
+
+#include "BinaryArchive.h"
+#include "GlobalTimer.h"
+#include "MappedFile.h"
+
 #include "Collections.h"
 
 using namespace adata;
 
-void Collections::fill(abase::DataCollector& collector, const std::string& conf_files, const std::string& conf_commands) {
+void Collections::fill(abase::DataCollector& collector, const std::string& conf_files, const std::string& conf_commands) const {
     // get the application path
     std::string app_path = get_parser_value<std::string>("application_path");
 
     // get the commands associated to the collector
     std::string commands = app_path + "/" +  get_parser_value<std::string>(conf_commands);
 
-    // get the files that store all data
-    std::string str_files = get_parser_value<std::string>(conf_files);
-    std::vector<std::string> files = str::split(str::replace(str_files, ",", " "));
-    
     // read data from the files
-    for (const auto& file : files) {
-        collector.read_data(app_path + "/" + file, commands);
+    for (const auto& file : get_conf_files(conf_files)) {
+        collector.read_data(file, commands);
     }
 
 }
 
-Collections::Collections() {
-    fill(materials, "material_files", "material_commands");
-    fill(laws, "fatigue_law_files", "material_commands");
-    fill(plate_coefficients, "plate_files", "plate_commands");
+std::vector<std::string> Collections::get_conf_files(const std::string& conf_key) const {
+    // get the application path
+    std::string app_path = get_parser_value<std::string>("application_path");
+
+    // get the files separated by commas or spaces
+    std::string str_files = get_parser_value<std::string>(conf_key);
+    std::vector<std::string> files = str::split(str::replace(str_files, ",", " "));
+    for (auto& file : files) file = app_path + "/" + file;
+    return files;
+}
+
+std::string Collections::sources_stamp(const std::vector<std::string>& conf_keys) const {
+    abase::BinaryWriter stamp;
+    stamp.write(SNAPSHOT_VERSION);
+    for (const auto& key : conf_keys) {
+        for (const auto& file : get_conf_files(key)) {
+            std::error_code status;
+            std::uint64_t size = std::filesystem::file_size(file, status);
+            auto time = std::filesystem::last_write_time(file, status).time_since_epoch().count();
+            stamp.write(file);
+            stamp.write(size);
+            stamp.write(static_cast<std::uint64_t>(time));
+        }
+    }
+    return stamp.data();
+}
+
+template<typename Collector>
+void Collections::load_collection(Collector& collector, const std::string& name,
+                                  const std::string& conf_files, const std::string& conf_commands) const {
+    // the timer is stopped if the reading fails, so that a new access can read the collection again
+    abase::ScopedTimer timer("load_" + name);
+
+    std::string app_path = get_parser_value<std::string>("application_path");
+    std::string filename = app_path + "/" + std::string(SNAPSHOT_DIR) + "/" + name + ".cache";
+    std::string stamp = sources_stamp({conf_commands, conf_files});
+
+    // read the snapshot if it is built from the current ressources files
+    bool loaded = false;
+    abase::MappedFile snapshot(filename);
+    if (snapshot.is_mapped()) {
+        abase::BinaryReader reader(snapshot.content());
+        std::string snapshot_stamp;
+        loaded = reader.read(snapshot_stamp) && snapshot_stamp == stamp && collector.load(reader) && reader.at_end();
+        if (!loaded) collector = Collector();
+    }
+
+    // otherwise read the ressources files and write the snapshot for the next runs
+    if (!loaded) {
+        collector = Collector();
+        fill(collector, conf_files, conf_commands);
+        abase::BinaryWriter writer;
+        writer.write(stamp);
+        collector.save(writer);
+        writer.save(filename);
+    }
 }
 
 std::shared_ptr<BaseMaterial> Collections::get_material(const std::string& material_id) const {
+    std::call_once(materials_loaded, [this]() {
+        load_collection(materials, "materials", "material_files", "material_commands");
+    });
     return materials.get_material(material_id);
 }
 
 std::shared_ptr<FatigueLaw> Collections::get_law(const std::string& law_id, 
                                                  const std::string& code, const std::string& edition) const {
+    std::call_once(laws_loaded, [this]() {
+        load_collection(laws, "fatigue_laws", "fatigue_law_files", "material_commands");
+    });
     return laws.get_law(law_id, code, edition);
 }
 
 std::shared_ptr<PlateCoefficients> Collections::get_coefficient(const std::string& function_id, const double ph) const {
+    std::call_once(plate_coefficients_loaded, [this]() {
+        load_collection(plate_coefficients, "plate_coefficients", "plate_files", "plate_commands");
+    });
     return plate_coefficients.get_coefficient(function_id, ph);
 }
 
 std::pair<double, double> Collections::get_ph_range(const std::string& function_id, const double ph) const {
+    std::call_once(plate_coefficients_loaded, [this]() {
+        load_collection(plate_coefficients, "plate_coefficients", "plate_files", "plate_commands");
+    });
     return plate_coefficients.get_ph_range(function_id, ph);
-}
\ No newline at end of file
+}
+
+std::shared_ptr<const RelocalisationFunction> Collections::get_relocalisation_function(const std::string& function_id,
+                                                                                       const double ph,
+                                                                                       const std::string& type) const {
+    auto key = std::make_tuple(type, function_id, ph);
+    {
+        std::lock_guard<std::mutex> lock(relocalisation_mutex);
+        auto it = relocalisation_functions.find(key);
+        if (it != relocalisation_functions.end()) return it->second;
+    }
+
+    // the function is built without the lock, the first built function is kept
+    std::shared_ptr<const RelocalisationFunction> function = build_relocalisation_function(function_id, ph, type);
+    std::lock_guard<std::mutex> lock(relocalisation_mutex);
+    return relocalisation_functions.emplace(key, function).first->second;
+}
+
+std::shared_ptr<const RelocalisationFunction> Collections::build_relocalisation_function(const std::string& function_id,
+                                                                                         double ph,
+                                                                                         const std::string& type) const {
+    auto function = std::make_shared<RelocalisationFunction>();
+    function->set_type(type);
+
+    std::shared_ptr<PlateCoefficients> coef = get_coefficient(function_id, ph);
+    if (coef != nullptr) {
+        function->set_coefficients(coef->angles, coef->a_phi, coef->b_phi, coef->c_phi);
+    } else {
+        std::pair<double, double> range = get_ph_range(function_id, ph);
+        std::shared_ptr<PlateCoefficients> lower = get_coefficient(function_id, range.first);
+        std::shared_ptr<PlateCoefficients> upper = get_coefficient(function_id, range.second);
+        if (lower == nullptr || upper == nullptr) {
+            error(translate("ERROR_PH_OUT_OF_RANGE", {function_id, std::to_string(ph)}));
+        }
+        function->build_relocalisation_function(ph, *lower, *upper);
+    }
+    function->set_periodic_conditions();
+    return function;
+}
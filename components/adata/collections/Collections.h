@@ -1,24 +1,73 @@
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <tuple>
+
 #include "Environment.h"
 
 #include "BaseMaterialCollector.h"
 #include "FatigueLawCollector.h"
 #include "PlateCoefficientsCollector.h"
+#include "RelocalisationFunction.h"
 
 namespace adata {
 
+    /// @brief Folder of the snapshot files of the collections (relative to the application path)
+    inline constexpr std::string_view SNAPSHOT_DIR = "etc";
+    /// @brief Version of the binary format of the snapshot file (to be increased when the format changes)
+    inline constexpr std::uint64_t SNAPSHOT_VERSION = 1;
+
+    /// @brief Physical data read from the ressources files (materials, fatigue laws and plate coefficients).
+    /// @details Each collection is read the first time it is accessed (thread-safe), so that a problem which does not
+    /// use a collection does not pay for its reading. A timer `load_<collection>` is started for each loaded
+    /// collection.
+    ///
+    /// A collection is written in a binary snapshot the first time it is read. Later runs map the snapshot instead of
+    /// reading the ressources files, as long as none of the files listed in its configuration keys has changed.
     class Collections {
         private:
-            void fill(abase::DataCollector& collector, const std::string& conf_files, const std::string& conf_commands);
+            void fill(abase::DataCollector& collector, const std::string& conf_files, const std::string& conf_commands) const;
+            /// @brief Return the files listed by a configuration key (absolute paths)
+            /// @param conf_key configuration key
+            /// @return list of files
+            std::vector<std::string> get_conf_files(const std::string& conf_key) const;
+            /// @brief Return the identification of the ressources files (name, size and modification time of each file)
+            /// @param conf_keys configuration keys listing the files
+            /// @return binary identification
+            std::string sources_stamp(const std::vector<std::string>& conf_keys) const;
+            /// @brief Read a collection from its snapshot file, or from the ressources files if the snapshot cannot be
+            /// used (the snapshot is then written)
+            /// @param collector collection to read
+            /// @param name name of the collection (used for the snapshot file and the timer)
+            /// @param conf_files configuration key of the ressources files
+            /// @param conf_commands configuration key of the commands file
+            template<typename Collector>
+            void load_collection(Collector& collector, const std::string& name,
+                                 const std::string& conf_files, const std::string& conf_commands) const;
+
+            mutable std::once_flag materials_loaded;
+            mutable std::once_flag laws_loaded;
+            mutable std::once_flag plate_coefficients_loaded;
+
+            /// @brief Relocalisation functions already built, by lattice type, function_id and P/h
+            mutable std::map<std::tuple<std::string, std::string, double>,
+                             std::shared_ptr<const RelocalisationFunction>> relocalisation_functions;
+            /// @brief Mutex protecting the relocalisation functions
+            mutable std::mutex relocalisation_mutex;
+            /// @brief Build a relocalisation function from the plate coefficients
+            std::shared_ptr<const RelocalisationFunction> build_relocalisation_function(const std::string& function_id,
+                                                                                        double ph,
+                                                                                        const std::string& type) const;
 
         protected:
-            BaseMaterialCollector materials;
-            FatigueLawCollector laws;
-            PlateCoefficientsCollector plate_coefficients;
+            mutable BaseMaterialCollector materials;
+            mutable FatigueLawCollector laws;
+            mutable PlateCoefficientsCollector plate_coefficients;
 
         public:
-            Collections();
+            Collections() = default;
             virtual ~Collections() = default;
 
             /// @brief Shortcut to BaseMaterialCollector::get_material function
@@ -45,6 +94,17 @@ namespace adata {
             /// @return pair of lower and upper bounds of P/h parameter
             std::pair<double, double> get_ph_range(const std::string& function_id, const double ph) const;
 
+            /// @brief Return the relocalisation function of a plate coefficient for a P/h ratio, interpolated between
+            /// the two nearest P/h values and completed by periodicity on [0, 360]. A function is built once and then
+            /// shared by all the callers (thread-safe).
+            /// @param function_id identification of the plate coefficient
+            /// @param ph value of the P/h parameter
+            /// @param type type of lattice
+            /// @return shared pointer to the relocalisation function
+            std::shared_ptr<const RelocalisationFunction> get_relocalisation_function(const std::string& function_id,
+                                                                                      const double ph,
+                                                                                      const std::string& type) const;
+
     };
 
 
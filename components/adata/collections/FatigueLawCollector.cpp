@@ -9,7 +9,7 @@ std::shared_ptr<FatigueLaw> FatigueLawCollector::create_law(const std::string& t
     return nullptr;
 }
 
-void FatigueLawCollector::set_data(const std::shared_ptr<abase::BaseCommand>& command, const std::string& filecontext) {
+void FatigueLawCollector::set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext) {
     std::string name = command->get_name();
 
     // create the fatigue law object
@@ -22,23 +22,80 @@ void FatigueLawCollector::set_data(const std::shared_ptr<abase::BaseCommand>& co
     new_law->init(command);
     new_law->verify(filecontext);
 
-    // check if the law already exists
-    for (const auto& law : laws) {
-        if (law->is_same_law(*new_law)) {
-            std::string msg = translate("FATIGUE_LAW_CONFLICT", new_law->get_id());
-            file_input_error(msg, filecontext);
+    // check if the law already exists (only the laws with the same identification can conflict)
+    auto same_id = laws_by_id.find(new_law->get_id());
+    if (same_id != laws_by_id.end()) {
+        for (std::size_t rank : same_id->second) {
+            if (laws[rank]->is_same_law(*new_law)) {
+                std::string msg = translate("FATIGUE_LAW_CONFLICT", new_law->get_id());
+                file_input_error(msg, filecontext);
+            }
         }
     }
 
     // add the fatigue law to the collection
-    laws.push_back(new_law);
+    add_law(new_law);
+}
+
+std::string FatigueLawCollector::law_key(const std::string& law_id, const std::string& code, 
+                                         const std::string& edition) {
+    return law_id + '\0' + code + '\0' + edition;
+}
+
+void FatigueLawCollector::add_law(const std::shared_ptr<FatigueLaw>& law) {
+    std::size_t rank = laws.size();
+    laws.push_back(law);
+
+    // the first law keeps its rank for a given key
+    laws_by_id[law->get_id()].push_back(rank);
+    if (law->is_code_free()) code_free_laws.emplace(law->get_id(), rank);
+    for (const auto& code : law->supported_codes()) {
+        code_laws.emplace(law_key(law->get_id(), code.first, code.second), rank);
+    }
+}
+
+void FatigueLawCollector::clear() {
+    laws.clear();
+    laws_by_id.clear();
+    code_free_laws.clear();
+    code_laws.clear();
 }
 
 std::shared_ptr<FatigueLaw> FatigueLawCollector::get_law(const std::string& law_id, const std::string& code="", 
                                                          const std::string& edition="") const { 
+    auto same_id = laws_by_id.find(law_id);
+    if (same_id == laws_by_id.end()) return nullptr;
+    if (code.empty()) return laws[same_id->second.front()];
+
+    // first law in the collection among the laws without code link and the laws supporting the code
+    std::size_t rank = laws.size();
+    auto code_free = code_free_laws.find(law_id);
+    if (code_free != code_free_laws.end()) rank = code_free->second;
+    auto coded = code_laws.find(law_key(law_id, str::lowercase(code), edition));
+    if (coded != code_laws.end()) rank = std::min(rank, coded->second);
+
+    return rank < laws.size() ? laws[rank] : nullptr;
+}
+
+void FatigueLawCollector::save(abase::BinaryWriter& writer) const {
+    writer.write(static_cast<std::uint64_t>(laws.size()));
     for (const auto& law : laws) {
-        if (law->get_id() == law_id && law->support_code(code, edition)) return law;
+        writer.write(law->get_type());
+        law->save(writer);
     }
-    return nullptr;
 }
 
+bool FatigueLawCollector::load(abase::BinaryReader& reader) {
+    clear();
+    std::uint64_t count = 0;
+    reader.read(count);
+    for (std::uint64_t i = 0; i < count && reader.good(); ++i) {
+        std::string type;
+        reader.read(type);
+        std::shared_ptr<FatigueLaw> law = create_law(type);
+        if (law == nullptr) return false;
+        law->load(reader);
+        add_law(law);
+    }
+    return reader.good();
+}
@@ -1,17 +1,31 @@
+#include <algorithm>
+
 #include "PlateCoefficientsCollector.h"
 
 using namespace adata;
 
-void PlateCoefficientsCollector::add_coefficient(std::shared_ptr<PlateCoefficients> coef, const std::string& filecontext) {
+namespace {
+    /// @brief Order of the plate coefficients of a function by P/h
+    bool coef_before_ph(const std::shared_ptr<PlateCoefficients>& coef, double ph) { return coef->Ph < ph; }
+    bool ph_before_coef(double ph, const std::shared_ptr<PlateCoefficients>& coef) { return ph < coef->Ph; }
+}
+
+void PlateCoefficientsCollector::add_coefficient(std::shared_ptr<PlateCoefficients> coef, const abase::FileContext& filecontext) {
     if (get_coefficient(coef->function_id, coef->Ph) != nullptr) {
         std::string msg = translate("PLATE_FUNCTION_CONFLICT", {coef->function_id, std::to_string(coef->Ph)});
         file_input_error(msg, filecontext);
     }    
+    index_coefficient(coef);
+}
+
+void PlateCoefficientsCollector::index_coefficient(const std::shared_ptr<PlateCoefficients>& coef) {
     coefficients_data.push_back(coef);
+    auto& function = coefficients_by_function[coef->function_id];
+    function.insert(std::upper_bound(function.begin(), function.end(), coef->Ph, ph_before_coef), coef);
 }
 
 void PlateCoefficientsCollector::set_data(const std::shared_ptr<abase::BaseCommand>& command, 
-                                          const std::string& filecontext) {
+                                          const abase::FileContext& filecontext) {
 
     std::string function_id, description;
     std::vector<double> ph_values;
@@ -54,10 +68,12 @@ void PlateCoefficientsCollector::set_data(const std::shared_ptr<abase::BaseComma
 
 std::shared_ptr<PlateCoefficients> PlateCoefficientsCollector::get_coefficient(const std::string& function_id, 
                                                                                const double ph) const {
-    for (const auto& coef : coefficients_data) {
-        if (coef->function_id == function_id && coef->Ph == ph) return coef;
-    }
-    return nullptr;
+    auto function = coefficients_by_function.find(function_id);
+    if (function == coefficients_by_function.end()) return nullptr;
+
+    const auto& coefs = function->second;
+    auto it = std::lower_bound(coefs.begin(), coefs.end(), ph, coef_before_ph);
+    return (it != coefs.end() && (*it)->Ph == ph) ? *it : nullptr;
 }
 
 std::pair<double, double> PlateCoefficientsCollector::get_ph_range(const std::string& function_id, 
@@ -65,14 +81,33 @@ std::pair<double, double> PlateCoefficientsCollector::get_ph_range(const std::st
     double lower_ph = std::numeric_limits<double>::min();
     double upper_ph = std::numeric_limits<double>::max();
 
-    for (const auto& coef : coefficients_data) {
-        // Check if the function_id is the same
-        if (coef->function_id != function_id) continue;
+    auto function = coefficients_by_function.find(function_id);
+    if (function == coefficients_by_function.end()) return std::make_pair(lower_ph, upper_ph);
 
-        // build p/h bounds
-        if (coef->Ph < ph) lower_ph = std::max(lower_ph, coef->Ph);
-        if (coef->Ph > ph) upper_ph = std::min(upper_ph, coef->Ph);
-    }
+    // build p/h bounds from the nearest values on each side
+    const auto& coefs = function->second;
+    auto lower = std::lower_bound(coefs.begin(), coefs.end(), ph, coef_before_ph);
+    auto upper = std::upper_bound(lower, coefs.end(), ph, ph_before_coef);
+    if (lower != coefs.begin()) lower_ph = std::max(lower_ph, (*std::prev(lower))->Ph);
+    if (upper != coefs.end()) upper_ph = std::min(upper_ph, (*upper)->Ph);
 
     return std::make_pair(lower_ph, upper_ph);
-}
\ No newline at end of file
+}
+
+void PlateCoefficientsCollector::save(abase::BinaryWriter& writer) const {
+    writer.write(static_cast<std::uint64_t>(coefficients_data.size()));
+    for (const auto& coef : coefficients_data) coef->save(writer);
+}
+
+bool PlateCoefficientsCollector::load(abase::BinaryReader& reader) {
+    coefficients_data.clear();
+    coefficients_by_function.clear();
+    std::uint64_t count = 0;
+    reader.read(count);
+    for (std::uint64_t i = 0; i < count && reader.good(); ++i) {
+        std::shared_ptr<PlateCoefficients> coef = std::make_shared<PlateCoefficients>();
+        coef->load(reader);
+        index_coefficient(coef);
+    }
+    return reader.good();
+}
@@ -16,13 +16,19 @@ namespace adata {
             /// @brief Add a plate coefficient object to the collection
             /// @param coef plate coefficient
             /// @param filecontext file context
-            void add_coefficient(std::shared_ptr<PlateCoefficients> coef, const std::string& filecontext);
+            void add_coefficient(std::shared_ptr<PlateCoefficients> coef, const abase::FileContext& filecontext);
+            /// @brief Add a plate coefficient to the collection and to the index
+            /// @param coef plate coefficient
+            void index_coefficient(const std::shared_ptr<PlateCoefficients>& coef);
+
+            /// @brief plate coefficients by function_id, sorted by increasing P/h
+            std::unordered_map<std::string, std::vector<std::shared_ptr<PlateCoefficients>>> coefficients_by_function;
 
         protected:
             /// @brief Convert read data from input file into data objects
             /// @param command read data from the input file
             /// @param filecontext file context
-            virtual void set_data(const std::shared_ptr<abase::BaseCommand>& command, const std::string& filecontext);
+            virtual void set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext);
 
             /// @brief Collection of plate coefficients
             std::vector<std::shared_ptr<PlateCoefficients>> coefficients_data;
@@ -42,6 +48,14 @@ namespace adata {
             /// @return pair of lower and upper bounds of P/h parameter
             std::pair<double, double> get_ph_range(const std::string& function_id, const double ph) const;
 
+            /// @brief Write the collection in a binary snapshot
+            /// @param writer binary writer
+            void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the collection from a binary snapshot
+            /// @param reader binary reader
+            /// @return false if the snapshot is corrupted
+            bool load(abase::BinaryReader& reader);
+
             /// @brief Clear the collection of plate coefficients
             void clear() { for (auto& data : coefficients_data) data->clear(); }
     };
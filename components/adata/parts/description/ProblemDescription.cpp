@@ -14,7 +14,7 @@ void ProblemDescription::init(const std::shared_ptr<abase::BaseCommand>& command
     abase::get_child_value(command, "UNITS", units);
 }
 
-void ProblemDescription::verify(const std::string& filecontext) const {
+void ProblemDescription::verify(const abase::FileContext& filecontext) const {
     // Version control is only required for catgory 2
     if (category != 2) return;
 
@@ -39,7 +39,7 @@ namespace adata::parts {
             /// @brief Verify if the object is correctly initialized
             /// @param filecontext context of the input file
             /// @return status of the object initialization
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
     };
 
 }
\ No newline at end of file
@@ -33,7 +33,7 @@ void ProblemFemInterface::init(const std::shared_ptr<abase::BaseCommand>& comman
     std::cout << "fem filename: " << filename << std::endl;
 }
 
-void ProblemFemInterface::verify(const std::string& filecontext) const {
+void ProblemFemInterface::verify(const abase::FileContext& filecontext) const {
     // Try conversion in absolute path
     try { 
         std::string realpath = abase::getAbsolutePath(filename);
@@ -26,7 +26,7 @@ namespace adata::parts {
             void init(const std::shared_ptr<abase::BaseCommand>& command);
             /// @brief Verify the coherence of object values
             /// @param filecontext file content
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
     };
 
 }
\ No newline at end of file
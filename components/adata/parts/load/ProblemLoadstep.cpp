@@ -55,7 +55,7 @@ void ProblemLoadstep::init(const std::shared_ptr<abase::BaseCommand>& command, s
     }
 }
 
-void ProblemLoadstep::verify(const std::string& filecontext) const {
+void ProblemLoadstep::verify(const abase::FileContext& filecontext) const {
     // check if the number of pressure cards is equal to the number of pressure values
     if (pressure_cards.size() != pressure_values.size()) {
         std::string nb_cards = std::to_string(pressure_cards.size());
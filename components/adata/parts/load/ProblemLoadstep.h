@@ -33,6 +33,10 @@ namespace adata::parts {
 
             ProblemLoadstep() = default;
             virtual ~ProblemLoadstep() = default;
+            ProblemLoadstep(const ProblemLoadstep&) = default;
+            ProblemLoadstep(ProblemLoadstep&&) = default;
+            ProblemLoadstep& operator=(const ProblemLoadstep&) = default;
+            ProblemLoadstep& operator=(ProblemLoadstep&&) = default;
 
             /// @brief Initialize the object with the values read from the input file
             /// @param command values read from the input file
@@ -42,7 +46,9 @@ namespace adata::parts {
             /// @brief Verify if the object is correctly initialized
             /// @param filecontext context of the input file
             /// @return status of the object initialization
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
+            /// @brief Return the number of external torsors given to `init`
+            std::size_t get_nb_torsors() const { return _nb_torsors; }
     };
 
 }
\ No newline at end of file
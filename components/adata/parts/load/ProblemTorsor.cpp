@@ -9,6 +9,6 @@ void ProblemTorsor::init(const std::shared_ptr<abase::BaseCommand>& command) {
     for (std::size_t i = 0; i < cards.size(); ++i) cards[i] -= 1;
 }
 
-void ProblemTorsor::verify(const std::string& filecontext) const {
+void ProblemTorsor::verify(const abase::FileContext& filecontext) const {
     // nothing to verify
 }
\ No newline at end of file
@@ -5,11 +5,7 @@
 using namespace adata::parts;
 
 std::size_t ProblemTransient::max_loadstesp() const {
-    std::size_t max = 0;
-    for (const auto& l : loadsteps) {
-        if (l > max) max = l;
-    }
-    return max;
+    return loadsteps.max();
 }
 
 void ProblemTransient::init(const std::shared_ptr<abase::BaseCommand>& command, std::size_t id, std::size_t nb_loadsteps) {
@@ -23,9 +19,7 @@ void ProblemTransient::init(const std::shared_ptr<abase::BaseCommand>& command,
     // get the number of cycles and loadsteps
     abase::get_child_value(command, "NCY", nb_cycles);
     abase::get_child_values(command, "NUMBERS", loadsteps);
-    if (!loadsteps.empty()) {
-        for (std::size_t i = 0; i < loadsteps.size(); ++i) loadsteps[i] -= 1;
-    }
+    if (!loadsteps.empty()) loadsteps.shift(-1);
 
     // get the groups and associated children parameters
     abase::get_child_values(command, "GROUP", groups);
@@ -55,7 +49,7 @@ void ProblemTransient::init(const std::shared_ptr<abase::BaseCommand>& command,
 
 }
 
-void ProblemTransient::verify(const std::string& filecontext) const {
+void ProblemTransient::verify(const abase::FileContext& filecontext) const {
     // check loadsteps indices
     if (max_loadstesp() >= _nb_loadsteps) {
         std::string max = std::to_string(max_loadstesp() + 1);
@@ -23,8 +23,8 @@ namespace adata::parts {
             std::string name = "";
             /// @brief number of cycles associated to the transient
             std::size_t nb_cycles = 0;
-            /// @brief time steps associated to the transient
-            std::vector<std::size_t> loadsteps;
+            /// @brief time steps associated to the transient (stored as ranges)
+            abase::RangeList loadsteps;
             /// @brief transient's groups
             std::vector<std::string> groups;
             /// @brief defined the crossing groups
@@ -54,7 +54,7 @@ namespace adata::parts {
             /// @brief Verify if the object is correctly initialized
             /// @param filecontext context of the input file
             /// @return status of the object initialization
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
     };
 
 }
\ No newline at end of file
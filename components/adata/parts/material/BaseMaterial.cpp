@@ -26,6 +26,26 @@ void BaseMaterial::init(const std::shared_ptr<abase::BaseCommand>& command) {
     abase::get_child_value(command, "N", n);
 }
 
-void BaseMaterial::verify(const std::string& filecontext) const {
+void BaseMaterial::verify(const abase::FileContext& filecontext) const {
     // TODO: Implement the verification of the object
 }
+
+void BaseMaterial::save(abase::BinaryWriter& writer) const {
+    writer.write(material_id);
+    writer.write(fatigue_law_id);
+    writer.write(steel_type);
+    writer.write(correction);
+    writer.write(Kf);
+    writer.write(m);
+    writer.write(n);
+}
+
+void BaseMaterial::load(abase::BinaryReader& reader) {
+    reader.read(material_id);
+    reader.read(fatigue_law_id);
+    reader.read(steel_type);
+    reader.read(correction);
+    reader.read(Kf);
+    reader.read(m);
+    reader.read(n);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BinaryArchive.h"
 #include "Environment.h"
 #include "Commands.h"
 #include "FileReader.h"
@@ -37,7 +38,16 @@ namespace adata::parts {
             virtual void init(const std::shared_ptr<abase::BaseCommand>& command);
             /// @brief Verify if the object is correctly initialized
             /// @param filecontext file input context
-            virtual void verify(const std::string& filecontext) const;
+            virtual void verify(const abase::FileContext& filecontext) const;
+
+            /// @brief Return the type of the material (command name in the material files)
+            virtual std::string get_type() const { return "BASE_MATERIAL"; }
+            /// @brief Write the object in a binary snapshot
+            /// @param writer binary writer
+            virtual void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the object from a binary snapshot
+            /// @param reader binary reader
+            virtual void load(abase::BinaryReader& reader);
     };
 
 
@@ -17,13 +17,13 @@ void DrainMaterial::init(const std::shared_ptr<abase::BaseCommand>& command) {
     abase::get_child_value(command, "STRESS_RATIO", stress_ratio);
     abase::get_child_value(command, "STRESS_LIMIT", stress_limit);
 
-    std::vector<double> xvalues, yvalues;
+    abase::Span<const double> xvalues, yvalues;
     abase::get_child_values(command, "ANGLES", xvalues);
     abase::get_child_values(command, "STRESS_INTENSITIES", yvalues);
-    if (xvalues.size() > 0 && yvalues.size() > 0) stress_intensities = amath::Table(xvalues, yvalues);
+    if (xvalues.size() > 0 && yvalues.size() > 0) stress_intensities = amath::Table(xvalues.begin(), xvalues.end(), yvalues.begin(), yvalues.end());
 }
 
-void DrainMaterial::verify(const std::string& filecontext) const {
+void DrainMaterial::verify(const abase::FileContext& filecontext) const {
     BaseMaterial::verify(filecontext);
     if (stress_limit <= 0.) {
         file_input_error(translate("ERROR_DRAIN_MATERIAL_LIMIT", material_id), filecontext);
@@ -31,4 +31,22 @@ void DrainMaterial::verify(const std::string& filecontext) const {
     if (stress_intensities.size() > 0 && stress_ratio <= 0.) {
         file_input_error(translate("ERROR_DRAIN_MATERIAL_RATIO", material_id), filecontext);
     }
-}
\ No newline at end of file
+}
+
+void DrainMaterial::save(abase::BinaryWriter& writer) const {
+    BaseMaterial::save(writer);
+    writer.write(stress_intensities.get_xvalues());
+    writer.write(stress_intensities.get_yvalues());
+    writer.write(stress_ratio);
+    writer.write(stress_limit);
+}
+
+void DrainMaterial::load(abase::BinaryReader& reader) {
+    BaseMaterial::load(reader);
+    std::vector<double> xvalues, yvalues;
+    reader.read(xvalues);
+    reader.read(yvalues);
+    if (xvalues.size() > 0 && yvalues.size() > 0) stress_intensities = amath::Table(xvalues, yvalues);
+    reader.read(stress_ratio);
+    reader.read(stress_limit);
+}
@@ -10,7 +10,7 @@ using namespace adata::parts;
 // Fatigue Law
 //
 
-void FatigueLaw::general_verification(const std::string& filecontext) const {
+void FatigueLaw::general_verification(const abase::FileContext& filecontext) const {
     if (law_id.empty()) {
         file_input_error(translate("ERROR_FATIGUE_LAW_ID"), filecontext);
     }
@@ -22,13 +22,16 @@ void FatigueLaw::general_verification(const std::string& filecontext) const {
     }
 }
 
-bool FatigueLaw::support_code(const std::string& code, const std::string& edition) const { 
-    // case for experimental fatigue laws without code link
-    std::size_t nb_codes = 0;
+bool FatigueLaw::is_code_free() const {
     for (const auto& known_code : {"rccm", "asme"}) {
-        if (descriptions.find(known_code) != descriptions.end()) ++nb_codes;
+        if (descriptions.find(known_code) != descriptions.end()) return false;
     }
-    if (nb_codes == 0) return true;
+    return true;
+}
+
+bool FatigueLaw::support_code(const std::string& code, const std::string& edition) const { 
+    // case for experimental fatigue laws without code link
+    if (is_code_free()) return true;
 
     // if code is empty, the law is supported
     if (code.empty()) return true;
@@ -45,6 +48,19 @@ bool FatigueLaw::support_code(const std::string& code, const std::string& editio
     return false;
 }
 
+std::vector<std::pair<std::string, std::string>> FatigueLaw::supported_codes() const {
+    std::vector<std::pair<std::string, std::string>> supported;
+    if (is_code_free()) return supported;
+
+    // same rules as support_code for a defined code
+    for (const auto& description : descriptions) supported.push_back({description.first, ""});
+    for (const auto& version : editions) {
+        if (descriptions.find(version.first) == descriptions.end()) continue;
+        for (const auto& edition : version.second) supported.push_back({version.first, edition});
+    }
+    return supported;
+}
+
 bool FatigueLaw::is_same_law(const FatigueLaw& other) const {
     if (law_id != other.law_id) return false;
 
@@ -92,6 +108,65 @@ void FatigueLaw::copy_generic_parameters(std::shared_ptr<FatigueLaw> other) cons
     other->editions = editions;
 }
 
+void FatigueLaw::save_generic_parameters(abase::BinaryWriter& writer) const {
+    writer.write(law_id);
+    writer.write(Ec);
+    writer.write(N_ratio);
+    writer.write(static_cast<std::uint64_t>(descriptions.size()));
+    for (const auto& description : descriptions) {
+        writer.write(description.first);
+        writer.write(description.second);
+    }
+    writer.write(static_cast<std::uint64_t>(editions.size()));
+    for (const auto& edition : editions) {
+        writer.write(edition.first);
+        writer.write(edition.second);
+    }
+}
+
+void FatigueLaw::load_generic_parameters(abase::BinaryReader& reader) {
+    reader.read(law_id);
+    reader.read(Ec);
+    reader.read(N_ratio);
+
+    std::uint64_t count = 0;
+    descriptions.clear();
+    reader.read(count);
+    for (std::uint64_t i = 0; i < count && reader.good(); ++i) {
+        std::string code, description;
+        reader.read(code);
+        reader.read(description);
+        descriptions[code] = description;
+    }
+    editions.clear();
+    reader.read(count);
+    for (std::uint64_t i = 0; i < count && reader.good(); ++i) {
+        std::string code;
+        std::vector<std::string> versions;
+        reader.read(code);
+        reader.read(versions);
+        editions[code] = versions;
+    }
+}
+
+std::size_t FatigueLaw::to_cycles(double na) {
+    if (!(na > 1.)) return 1;
+    if (na >= static_cast<double>(std::numeric_limits<std::size_t>::max())) return std::numeric_limits<std::size_t>::max();
+    return static_cast<std::size_t>(na);
+}
+
+std::size_t FatigueLaw::allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const {
+    Na.resize(Sa.size());
+    for (std::size_t k = 0; k < Sa.size(); ++k) Na[k] = std::isnan(Sa[k]) ? 1 : allowable_cycles(Sa[k]);
+    return 0;
+}
+
+std::size_t FatigueLaw::allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const {
+    Sa.resize(Na.size());
+    for (std::size_t k = 0; k < Na.size(); ++k) Sa[k] = allowable_stress(Na[k]);
+    return 0;
+}
+
 //
 // Tabular Fatigue Law
 //
@@ -105,7 +180,7 @@ double TabularFatigueLaw::allowable_stress(std::size_t Na) const {
         warning(translate("FATIGUE_STRESS_INTERPOLATION_WARNING", {str_Na, str_Sa}));
         return table.get_ymax();
     }
-    return table.get_yvalue(na, "logarithmic");    
+    return stress_curve.get_yvalue(na);
 }
 
 std::size_t TabularFatigueLaw::allowable_cycles(double Sa) const {
@@ -115,21 +190,63 @@ std::size_t TabularFatigueLaw::allowable_cycles(double Sa) const {
         warning(translate("FATIGUE_CYCLE_INTERPOLATION_WARNING", str_Sa));
         return 1.;
     }
-    double na = table.get_xvalue(Sa, "logarithmic")/N_ratio;
-    return std::size_t(std::ceil(na));
+    double na = cycles_curve.get_yvalue(Sa)/N_ratio;
+    return to_cycles(std::ceil(na));
+}
+
+std::size_t TabularFatigueLaw::allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const {
+    double Sa_min = table.get_ymin();
+    double Sa_max = table.get_ymax();
+    std::vector<double> na;
+    cycles_curve.get_yvalues(Sa, na);
+
+    std::size_t nb_above = 0;
+    Na.resize(Sa.size());
+    for (std::size_t k = 0; k < Sa.size(); ++k) {
+        bool below = Sa[k] < Sa_min;
+        bool above = Sa[k] > Sa_max;
+        nb_above += above ? 1 : 0;
+        Na[k] = below ? std::numeric_limits<std::size_t>::max()
+                      : (above ? 1 : to_cycles(std::ceil(na[k] / N_ratio)));
+    }
+    return nb_above;
+}
+
+std::size_t TabularFatigueLaw::allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const {
+    std::vector<double> na(Na.size());
+    for (std::size_t k = 0; k < Na.size(); ++k) na[k] = Na[k]*N_ratio;
+    stress_curve.get_yvalues(na, Sa);
+
+    double na_min = table.get_xmin();
+    double na_max = table.get_xmax();
+    double Sa_max = table.get_ymax();
+    std::size_t nb_below = 0;
+    for (std::size_t k = 0; k < Na.size(); ++k) {
+        bool below = na[k] < na_min;
+        nb_below += below ? 1 : 0;
+        Sa[k] = na[k] > na_max ? 0. : (below ? Sa_max : Sa[k]);
+    }
+    return nb_below;
+}
+
+void TabularFatigueLaw::compile() {
+    if (table.size() == 0) return;
+    stress_curve = amath::CompiledTable(table, "logarithmic");
+    cycles_curve = amath::CompiledTable::inverse(table, "logarithmic");
 }
 
 void TabularFatigueLaw::init(const std::shared_ptr<abase::BaseCommand>& command) {
     set_generic_parameters(command);
     
-    std::vector<double> xvalues, yvalues;
+    abase::Span<const double> xvalues, yvalues;
     abase::get_child_values(command, "NA", xvalues);
     abase::get_child_values(command, "SA", yvalues);
 
-    if (xvalues.size() > 0 && yvalues.size() > 0) table = amath::Table(xvalues, yvalues);
+    if (xvalues.size() > 0 && yvalues.size() > 0) table = amath::Table(xvalues.begin(), xvalues.end(), yvalues.begin(), yvalues.end());
+    compile();
 }
 
-void TabularFatigueLaw::verify(const std::string& filecontext) const {
+void TabularFatigueLaw::verify(const abase::FileContext& filecontext) const {
     general_verification(filecontext);
     if (table.size() < 2) {
         file_input_error(translate("ERROR_FATIGUE_LAW_TABLE_SIZE", law_id), filecontext);
@@ -149,10 +266,27 @@ std::shared_ptr<FatigueLaw> TabularFatigueLaw::clone() const {
 
     // specific parameters
     a_clone->table = table;
+    a_clone->stress_curve = stress_curve;
+    a_clone->cycles_curve = cycles_curve;
 
     return a_clone;
 }
 
+void TabularFatigueLaw::save(abase::BinaryWriter& writer) const {
+    save_generic_parameters(writer);
+    writer.write(table.get_xvalues());
+    writer.write(table.get_yvalues());
+}
+
+void TabularFatigueLaw::load(abase::BinaryReader& reader) {
+    load_generic_parameters(reader);
+    std::vector<double> xvalues, yvalues;
+    reader.read(xvalues);
+    reader.read(yvalues);
+    if (xvalues.size() > 0 && yvalues.size() > 0) table = amath::Table(xvalues, yvalues);
+    compile();
+}
+
 //
 // Power Fatigue Law
 //
@@ -164,7 +298,27 @@ double PowerFatigueLaw::allowable_stress(std::size_t Na) const {
 
 std::size_t PowerFatigueLaw::allowable_cycles(double Sa) const {
     double na = alpha/std::pow(Sa, beta)/N_ratio;
-    return std::max(na, 1.);
+    return to_cycles(na);
+}
+
+std::size_t PowerFatigueLaw::allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const {
+    double log_factor = std::log(alpha/N_ratio);
+    std::vector<double> na(Sa.size());
+    for (std::size_t k = 0; k < Sa.size(); ++k) na[k] = std::exp(log_factor - beta*std::log(Sa[k]));
+
+    Na.resize(Sa.size());
+    for (std::size_t k = 0; k < Sa.size(); ++k) Na[k] = to_cycles(na[k]);
+    return 0;
+}
+
+std::size_t PowerFatigueLaw::allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const {
+    double log_alpha = std::log(alpha);
+    double log_ratio = std::log(N_ratio);
+    Sa.resize(Na.size());
+    for (std::size_t k = 0; k < Na.size(); ++k) {
+        Sa[k] = std::exp((log_alpha - std::log(static_cast<double>(Na[k])) - log_ratio)/beta);
+    }
+    return 0;
 }
 
 void PowerFatigueLaw::init(const std::shared_ptr<abase::BaseCommand>& command) {
@@ -178,7 +332,7 @@ void PowerFatigueLaw::init(const std::shared_ptr<abase::BaseCommand>& command) {
     abase::get_child_value(command, "BETA", beta);
 }
 
-void PowerFatigueLaw::verify(const std::string& filecontext) const {
+void PowerFatigueLaw::verify(const abase::FileContext& filecontext) const {
     general_verification(filecontext);
     if (Seq <= 0.) {
         file_input_error(translate("ERROR_FATIGUE_LAW_PARAMETER", {"Seq", law_id}), filecontext);
@@ -204,46 +358,68 @@ std::shared_ptr<FatigueLaw> PowerFatigueLaw::clone() const {
 }
 
 
+void PowerFatigueLaw::save(abase::BinaryWriter& writer) const {
+    save_generic_parameters(writer);
+    writer.write(alpha);
+    writer.write(beta);
+    writer.write(Seq);
+}
+
+void PowerFatigueLaw::load(abase::BinaryReader& reader) {
+    load_generic_parameters(reader);
+    reader.read(alpha);
+    reader.read(beta);
+    reader.read(Seq);
+}
+
 //
 // Polynomial Fatigue Law
 //
 
 double PolynomialFatigueLaw::allowable_stress(std::size_t Na) const {
-    double na = Na*N_ratio;
-    double Sa = 0.;
-    for (std::size_t i = 0; i < coefficients.size(); ++i) {
-        Sa += coefficients[i]*std::pow(na, i);
-    }
-    return Sa;
+    return curve.value(Na*N_ratio);
 }
 
 std::size_t PolynomialFatigueLaw::allowable_cycles(double Sa) const {
-    /*
-    // Create the polynomial coefficients for the equation Sa = c0 + c1*na + c2*na^2 + ... + cn*na^n
-    Eigen::VectorXd poly_coeffs(coefficients.size());
-    for (std::size_t i = 0; i < coefficients.size(); ++i) {
-        poly_coeffs[i] = coefficients[i];
+    if (Sa < Seq) return std::numeric_limits<std::size_t>::max();
+    if (Sa > curve.get_ymax()) {
+        std::string str_Sa = std::to_string(Sa);
+        warning(translate("FATIGUE_CYCLE_INTERPOLATION_WARNING", str_Sa));
+        return 1;
     }
-    // Subtract Sa from the constant term to set up the equation Sa - (c0 + c1*na + c2*na^2 + ... + cn*na^n) = 0
-    poly_coeffs[0] -= Sa; 
-
-    // Solve for the roots of the polynomial
-    Eigen::PolynomialSolver<double, Eigen::Dynamic> solver;
-    solver.compute(poly_coeffs);
-
-    // Find the smallest positive root
-    std::size_t allowable_cycles = 0;
-    for (const auto& root : solver.roots()) {
-        if (root.real() > 0 && std::abs(root.imag()) < std::numeric_limits<double>::epsilon()) {
-            double na = root.real() / N_ratio;
-            if (na > 0) {
-                allowable_cycles = std::min(allowable_cycles, std::size_t(std::ceil(na)));
-            }
-        }
+    double na = curve.inverse(Sa);
+    // no crossing of the curve on its interval (an undefined stress gives 1 cycle)
+    if (std::isnan(na) && !std::isnan(Sa)) return std::numeric_limits<std::size_t>::max();
+    return to_cycles(std::ceil(na/N_ratio));
+}
+
+std::size_t PolynomialFatigueLaw::allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const {
+    std::vector<double> na;
+    curve.inverse(Sa, na);
+
+    double Sa_max = curve.get_ymax();
+    std::size_t nb_above = 0;
+    Na.resize(Sa.size());
+    for (std::size_t k = 0; k < Sa.size(); ++k) {
+        bool infinite = Sa[k] < Seq || (std::isnan(na[k]) && !std::isnan(Sa[k]));
+        bool above = !infinite && Sa[k] > Sa_max;
+        nb_above += above ? 1 : 0;
+        Na[k] = infinite ? std::numeric_limits<std::size_t>::max()
+                         : (above ? 1 : to_cycles(std::ceil(na[k]/N_ratio)));
     }
-    return allowable_cycles;    
-    */
-   return 0;
+    return nb_above;
+}
+
+std::size_t PolynomialFatigueLaw::allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const {
+    std::vector<double> na(Na.size());
+    for (std::size_t k = 0; k < Na.size(); ++k) na[k] = Na[k]*N_ratio;
+    curve.values(na, Sa);
+    return 0;
+}
+
+void PolynomialFatigueLaw::compile() {
+    if (coefficients.empty()) return;
+    curve = amath::PolynomialCurve(coefficients, 1., POLYNOMIAL_FATIGUE_LAW_NMAX);
 }
 
 void PolynomialFatigueLaw::init(const std::shared_ptr<abase::BaseCommand>& command) {
@@ -255,13 +431,17 @@ void PolynomialFatigueLaw::init(const std::shared_ptr<abase::BaseCommand>& comma
     abase::get_child_value(command, "BETA", beta);
     abase::get_child_value(command, "SEQ", Seq);
     abase::get_child_values(command, "COEFFICIENTS", coefficients);
+    compile();
 }
 
-void PolynomialFatigueLaw::verify(const std::string& filecontext) const {
+void PolynomialFatigueLaw::verify(const abase::FileContext& filecontext) const {
     general_verification(filecontext);
     if (Seq <= 0.) {
         file_input_error(translate("ERROR_FATIGUE_LAW_PARAMETER", {"Seq", law_id}), filecontext);
     }
+    if (coefficients.empty()) {
+        file_input_error(translate("ERROR_FATIGUE_LAW_PARAMETER", {"coefficients", law_id}), filecontext);
+    }
 }
 
 std::shared_ptr<FatigueLaw> PolynomialFatigueLaw::clone() const {
@@ -271,6 +451,23 @@ std::shared_ptr<FatigueLaw> PolynomialFatigueLaw::clone() const {
     // specific parameters
     a_clone->Seq = Seq;
     a_clone->coefficients = coefficients;
+    a_clone->beta = beta;
+    a_clone->curve = curve;
 
     return a_clone;
-}
\ No newline at end of file
+}
+
+void PolynomialFatigueLaw::save(abase::BinaryWriter& writer) const {
+    save_generic_parameters(writer);
+    writer.write(coefficients);
+    writer.write(beta);
+    writer.write(Seq);
+}
+
+void PolynomialFatigueLaw::load(abase::BinaryReader& reader) {
+    load_generic_parameters(reader);
+    reader.read(coefficients);
+    reader.read(beta);
+    reader.read(Seq);
+    compile();
+}
@@ -0,0 +1,69 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "FatigueUsageBatch.h"
+
+using namespace adata::parts;
+
+void PairBatch::clear() {
+    state1.clear();
+    state2.clear();
+    Sn.clear();
+    Sp.clear();
+}
+
+void PairBatch::add(std::size_t s1, std::size_t s2, double sn, double sp) {
+    state1.push_back(s1);
+    state2.push_back(s2);
+    Sn.push_back(sn);
+    Sp.push_back(sp);
+}
+
+FatigueUsageBatch::FatigueUsageBatch(const BaseMaterial& material, std::shared_ptr<const FatigueLaw> law)
+    : _law_(std::move(law)) {
+    if (!_law_) throw std::invalid_argument("Undefined fatigue law");
+    if (material.m > 1. && material.n > 0.) {
+        ke_slope = (1. - material.n) / (material.n * (material.m - 1.));
+        ke_span = material.m - 1.;
+    }
+}
+
+void FatigueUsageBatch::evaluate(const PairBatch& pairs, const MaterialStates& states, const std::string& EcE_type,
+                                 UsageBatchResults& results) const {
+    std::size_t size = pairs.size();
+    results.Ke.resize(size);
+    results.Salt.resize(size);
+    results.usage.resize(size);
+
+    // Ke and alternating stress: an undefined Sm or Ec/E (NaN value of MaterialStates) gives an undefined
+    // alternating stress (std::max and std::min return their first argument when it is NaN)
+    const std::vector<double>& Sm = states.get_values(MaterialProperty::Sm);
+    for (std::size_t k = 0; k < size; ++k) {
+        double Sm_pair = 0.5 * (Sm[pairs.state1[k]] + Sm[pairs.state2[k]]);
+        double ratio = pairs.Sn[k] / (3. * Sm_pair) - 1.;
+        results.Ke[k] = 1. + ke_slope * std::min(std::max(ratio, 0.), ke_span);
+    }
+    std::size_t nb_undefined = 0;
+    for (std::size_t k = 0; k < size; ++k) {
+        double EcE = states.get_EcE(pairs.state1[k], pairs.state2[k], EcE_type);
+        results.Salt[k] = 0.5 * results.Ke[k] * pairs.Sp[k] * EcE;
+        nb_undefined += std::isfinite(results.Salt[k]) ? 0 : 1;
+    }
+    if (nb_undefined > 0) {
+        error(translate("ERROR_FATIGUE_UNDEFINED_ALTERNATING_STRESS", {std::to_string(nb_undefined), _law_->get_id()}));
+    }
+
+    // allowable numbers of cycles and usage
+    results.nb_above_curve = _law_->allowable_cycles(results.Salt, results.cycles);
+    for (std::size_t k = 0; k < size; ++k) {
+        std::size_t cycles = results.cycles[k];
+        results.usage[k] = cycles == std::numeric_limits<std::size_t>::max() ? 0. : 1. / static_cast<double>(cycles);
+    }
+
+    if (results.nb_above_curve > 0) {
+        double Salt_max = *std::max_element(results.Salt.begin(), results.Salt.end());
+        warning(translate("FATIGUE_CYCLE_INTERPOLATION_BATCH_WARNING",
+                          {std::to_string(results.nb_above_curve), std::to_string(Salt_max), _law_->get_id()}));
+    }
+}
@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "MaterialStates.h"
+
+using namespace adata::parts;
+
+const amath::LinearCoefficient& MaterialStates::coefficient(const ProblemMaterial& material,
+                                                            MaterialProperty property) {
+    switch (property) {
+        case MaterialProperty::E: return material.get_E();
+        case MaterialProperty::Sm: return material.get_Sm();
+        case MaterialProperty::Su: return material.get_Su();
+        case MaterialProperty::Scy: return material.get_Scy();
+        case MaterialProperty::Sy: return material.get_Sy();
+        default: return material.get_Syg();
+    }
+}
+
+double MaterialStates::combine(double v1, double v2, const std::string& type) {
+    // an undefined value of one of the states gives an undefined value of the pair
+    if (std::isnan(v1) || std::isnan(v2)) return std::numeric_limits<double>::quiet_NaN();
+    if (type == "min") return std::min(v1, v2);
+    if (type == "max") return std::max(v1, v2);
+    if (type != "mean") throw std::invalid_argument("Invalid combination of material properties " + type);
+    return 0.5 * (v1 + v2);
+}
+
+bool MaterialStates::update(const ProblemMaterial& material, const std::vector<double>& temperatures) {
+    if (_defined_ && _rank_ == material.rank && _revision_ == material.get_revision() && _temperatures_ == temperatures) {
+        return false;
+    }
+
+    _defined_ = true;
+    _rank_ = material.rank;
+    _revision_ = material.get_revision();
+    _temperatures_ = temperatures;
+    for (std::size_t rank = 0; rank < NB_MATERIAL_PROPERTIES; ++rank) {
+        const auto& coef = coefficient(material, static_cast<MaterialProperty>(rank));
+        if (coef.is_defined()) {
+            coef.get_yvalues(_temperatures_, _values_[rank]);
+        } else {
+            _values_[rank].assign(_temperatures_.size(), std::numeric_limits<double>::quiet_NaN());
+        }
+    }
+
+    const auto& young = _values_[static_cast<std::size_t>(MaterialProperty::E)];
+    _EcE_.resize(young.size());
+    for (std::size_t state = 0; state < young.size(); ++state) _EcE_[state] = material.get_Eref() / young[state];
+    return true;
+}
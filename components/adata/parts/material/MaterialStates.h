@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+
+#include "Environment.h"
+
+#include "ProblemMaterial.h"
+
+namespace adata::parts {
+
+    /// @brief Temperature-dependent properties of a material (rank of the property in MaterialStates)
+    enum class MaterialProperty : std::size_t { E = 0, Sm = 1, Su = 2, Scy = 3, Sy = 4, Syg = 5 };
+    /// @brief Number of temperature-dependent properties of a material
+    static constexpr std::size_t NB_MATERIAL_PROPERTIES = 6;
+
+    /// @brief Temperature-dependent properties of a material evaluated for each state (load step) of a section
+    /// @details Each property is interpolated once for each state in a contiguous array, with the compiled table of
+    /// the property. The values of a pair of states are then obtained from two array loads. The arrays are rebuilt
+    /// only when the material (rank and revision, see ProblemMaterial::get_revision) or the temperatures of the
+    /// states change. The properties which are not defined for
+    /// the material, and the temperatures outside the table of a property, give NaN values.
+    class MaterialStates {
+        private:
+            /// @brief true if the current values are defined
+            bool _defined_ = false;
+            /// @brief rank of the material of the current values
+            std::size_t _rank_ = 0;
+            /// @brief revision of the material of the current values
+            std::size_t _revision_ = 0;
+            /// @brief temperatures of the states
+            std::vector<double> _temperatures_;
+            /// @brief values of each property for each state (by rank of MaterialProperty)
+            std::array<std::vector<double>, NB_MATERIAL_PROPERTIES> _values_;
+            /// @brief ratio \f$ \frac{E_c}{E} \f$ for each state
+            std::vector<double> _EcE_;
+
+            /// @brief Return the coefficient of a property of the material
+            /// @param material material
+            /// @param property property
+            static const amath::LinearCoefficient& coefficient(const ProblemMaterial& material,
+                                                               MaterialProperty property);
+            /// @brief Combine the values of two states (NaN if one of the values is NaN)
+            /// @param v1 value of the first state
+            /// @param v2 value of the second state
+            /// @param type "mean", "min" or "max"
+            static double combine(double v1, double v2, const std::string& type);
+
+        public:
+            MaterialStates() = default;
+            virtual ~MaterialStates() = default;
+
+            /// @brief Evaluate the properties of a material for the temperatures of the states. Nothing is done if
+            /// the material (same rank and revision) and the temperatures are the ones of the current values.
+            /// @param material material
+            /// @param temperatures temperature of each state
+            /// @return true if the values have been rebuilt
+            bool update(const ProblemMaterial& material, const std::vector<double>& temperatures);
+            /// @brief Force the values to be rebuilt by the next update
+            void invalidate() { _defined_ = false; }
+
+            /// @brief Return the number of states
+            std::size_t size() const { return _temperatures_.size(); }
+            /// @brief Return the value of a property for a state
+            /// @param property property
+            /// @param state rank of the state
+            double get(MaterialProperty property, std::size_t state) const {
+                return _values_[static_cast<std::size_t>(property)][state];
+            }
+            /// @brief Return the values of a property for all the states
+            /// @param property property
+            const std::vector<double>& get_values(MaterialProperty property) const {
+                return _values_[static_cast<std::size_t>(property)];
+            }
+            /// @brief Return the value of a property for a pair of states
+            /// @param property property
+            /// @param state1 rank of the first state
+            /// @param state2 rank of the second state
+            /// @param type combination of the values of the states: "mean", "min" or "max"
+            double get_pair(MaterialProperty property, std::size_t state1, std::size_t state2,
+                            const std::string& type = "mean") const {
+                return combine(get(property, state1), get(property, state2), type);
+            }
+            /// @brief Return the ratio \f$ \frac{E_c}{E} \f$ for a pair of states
+            /// @param state1 rank of the first state
+            /// @param state2 rank of the second state
+            /// @param type type of temperature dependence: "none" (ratio equal to 1), "mean", "min" or "max"
+            double get_EcE(std::size_t state1, std::size_t state2, const std::string& type) const {
+                if (type == "none") return 1.;
+                return combine(_EcE_[state1], _EcE_[state2], type);
+            }
+    };
+}
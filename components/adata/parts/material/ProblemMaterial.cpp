@@ -1,7 +1,14 @@
+#include <atomic>
+
 #include "ProblemMaterial.h"
 
 using namespace adata::parts;
 
+std::size_t ProblemMaterial::next_revision() {
+    static std::atomic<std::size_t> last_revision{0};
+    return ++last_revision;
+}
+
 std::string ProblemMaterial::get_correction_name(const std::string& int_correction) const {
     std::string correction = str::lowercase(int_correction);
     for (const auto& [key, value] : _correction_map_) {
@@ -31,6 +38,9 @@ void ProblemMaterial::set_material_parameters(const std::shared_ptr<abase::BaseC
 
 
 void ProblemMaterial::init(const std::shared_ptr<abase::BaseCommand>& command, std::size_t id) {
+    rank = id;
+    touch();
+
     // get the name of the material
     abase::get_child_value(command, "NAME", name);
     if (name.empty()) default_name(id);
@@ -38,7 +48,7 @@ void ProblemMaterial::init(const std::shared_ptr<abase::BaseCommand>& command, s
     abase::get_child_value(command, "LAW", base_material_id);
     abase::get_child_values(command, "KETABLE", Ke_table_name);
 
-    abase::get_child_value(command, "EREF", Eref);
+    abase::get_child_value(command, "EREF", _Eref_);
     abase::get_child_value(command, "TYPM", typm);
     abase::get_child_value(command, "KF", Kf);
     abase::get_child_value(command, "TABLE", user_law_table);
@@ -56,6 +66,6 @@ void ProblemMaterial::init(const std::shared_ptr<abase::BaseCommand>& command, s
 
 }
 
-void ProblemMaterial::verify(const std::string& filecontext) const {
+void ProblemMaterial::verify(const abase::FileContext& filecontext) const {
     // TODO: implement the verification of the material
 }
\ No newline at end of file
@@ -26,7 +26,34 @@ namespace adata::parts {
             /// @param command input command
             void set_material_parameters(const std::shared_ptr<abase::BaseCommand>& command);
 
+            /// @brief Young modulus \f$ E \f$ for the material
+            amath::LinearCoefficient _E_;
+            /// @brief Admissible stress \f$ S_m \f$ for the material
+            amath::LinearCoefficient _Sm_;
+            /// @brief Ultimate tensile stress \f$ S_u \f$ for the material
+            amath::LinearCoefficient _Su_;
+            /// @brief Cyclic yield stress \f$ S_{cy} \f$ for the material used for mean stress correction with 
+            /// experimental fatigue laws.
+            amath::LinearCoefficient _Scy_;
+            /// @brief Conventionnal yield stress \f$ S_y \f$ for the material (used for thermal ratchet). By default,
+            /// it is equal to the ultimate tensile stress \f$ 1.5 S_m \f$.
+            amath::LinearCoefficient _Sy_;
+            /// @brief Conventionnal yield stress \f$ S_{yg} \f$ for a large number of cycles (used for thermal ratchet).
+            amath::LinearCoefficient _Syg_;
+
+            /// @brief Reference Young modulus \f$ E_{c} \f$ for the material
+            double _Eref_ = 0.0;
+
+            /// @brief Revision of the material properties (see `get_revision`)
+            std::size_t revision = next_revision();
+            /// @brief Return a new revision, different from all the revisions given before to any material
+            static std::size_t next_revision();
+            /// @brief Set a new revision after a modification of the properties
+            void touch() { revision = next_revision(); }
+
         public :
+            /// @brief Rank of the material in the input data
+            std::size_t rank = 0;
             /// @brief Name of the object
             std::string name = "";
             /// @brief Base material id associate to the object
@@ -48,25 +75,8 @@ namespace adata::parts {
             ///  - "SYG" : Conventionnal yield stress for a large number of cycles \f$ S_{yg} \f$
             std::unordered_map<std::string, std::pair<std::string, double>> material_parameters_input;
 
-            /// @brief Young modulus \f$ E \f$ for the material
-            amath::LinearCoefficient E;
-            /// @brief Admissible stress \f$ S_m \f$ for the material
-            amath::LinearCoefficient Sm;
-            /// @brief Ultimate tensile stress \f$ S_u \f$ for the material
-            amath::LinearCoefficient Su;
-            /// @brief Cyclic yield stress \f$ S_{cy} \f$ for the material used for mean stress correction with 
-            /// experimental fatigue laws.
-            amath::LinearCoefficient Scy;
-            /// @brief Conventionnal yield stress \f$ S_y \f$ for the material (used for thermal ratchet). By default,
-            /// it is equal to the ultimate tensile stress \f$ 1.5 S_m \f$.
-            amath::LinearCoefficient Sy;
-            /// @brief Conventionnal yield stress \f$ S_{yg} \f$ for a large number of cycles (used for thermal ratchet).
-            amath::LinearCoefficient Syg;
-
             std::vector<std::string> Ke_table_name;
 
-            /// @brief Reference Young modulus \f$ E_{c} \f$ for the material
-            double Eref = 0.0;
             /// @brief Reference to base material for the choice of \f$ K_e \f$ calculation. Undefined values means
             /// that the base material method is used for the calculation.
             std::string typm = "";
@@ -91,7 +101,43 @@ namespace adata::parts {
             /// @param id rank associated to the material
             void init(const std::shared_ptr<abase::BaseCommand>& command, std::size_t id);
             /// @brief Verify the coherence of the material definition
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
+
+            /// @brief Return the Young modulus \f$ E \f$
+            const amath::LinearCoefficient& get_E() const { return _E_; }
+            /// @brief Return the admissible stress \f$ S_m \f$
+            const amath::LinearCoefficient& get_Sm() const { return _Sm_; }
+            /// @brief Return the ultimate tensile stress \f$ S_u \f$
+            const amath::LinearCoefficient& get_Su() const { return _Su_; }
+            /// @brief Return the cyclic yield stress \f$ S_{cy} \f$
+            const amath::LinearCoefficient& get_Scy() const { return _Scy_; }
+            /// @brief Return the conventionnal yield stress \f$ S_y \f$
+            const amath::LinearCoefficient& get_Sy() const { return _Sy_; }
+            /// @brief Return the conventionnal yield stress \f$ S_{yg} \f$ for a large number of cycles
+            const amath::LinearCoefficient& get_Syg() const { return _Syg_; }
+            /// @brief Return the reference Young modulus \f$ E_{c} \f$
+            double get_Eref() const { return _Eref_; }
+
+            /// @brief Set the Young modulus \f$ E \f$ (new revision of the material)
+            void set_E(const amath::LinearCoefficient& E) { _E_ = E; touch(); }
+            /// @brief Set the admissible stress \f$ S_m \f$ (new revision of the material)
+            void set_Sm(const amath::LinearCoefficient& Sm) { _Sm_ = Sm; touch(); }
+            /// @brief Set the ultimate tensile stress \f$ S_u \f$ (new revision of the material)
+            void set_Su(const amath::LinearCoefficient& Su) { _Su_ = Su; touch(); }
+            /// @brief Set the cyclic yield stress \f$ S_{cy} \f$ (new revision of the material)
+            void set_Scy(const amath::LinearCoefficient& Scy) { _Scy_ = Scy; touch(); }
+            /// @brief Set the conventionnal yield stress \f$ S_y \f$ (new revision of the material)
+            void set_Sy(const amath::LinearCoefficient& Sy) { _Sy_ = Sy; touch(); }
+            /// @brief Set the conventionnal yield stress \f$ S_{yg} \f$ (new revision of the material)
+            void set_Syg(const amath::LinearCoefficient& Syg) { _Syg_ = Syg; touch(); }
+            /// @brief Set the reference Young modulus \f$ E_{c} \f$ (new revision of the material)
+            void set_Eref(double Eref) { _Eref_ = Eref; touch(); }
+
+            /// @brief Return the revision of the material properties. A copy of the material has the same revision,
+            /// a new revision (never given to another material) is set by `init` and by each setter of the
+            /// properties. Caches of the properties (see MaterialStates) are keyed on the rank and the revision of the
+            /// material.
+            std::size_t get_revision() const { return revision; }
     };
 
 }
\ No newline at end of file
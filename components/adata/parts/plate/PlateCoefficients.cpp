@@ -20,7 +20,7 @@ void PlateCoefficients::init(const std::shared_ptr<abase::BaseCommand>& command)
     abase::get_child_values(command, "CPHI", c_phi);
 }
 
-void PlateCoefficients::verify(const std::string& filecontext) const {
+void PlateCoefficients::verify(const abase::FileContext& filecontext) const {
     std::string coef_msg = "";
     if (angles.size() != a_phi.size()) {
         coef_msg = coef_msg.empty() ? "a_phi" : ", a_phi";
@@ -37,4 +37,24 @@ void PlateCoefficients::verify(const std::string& filecontext) const {
         std::string msg = translate("ERROR_USER_COEFFICIENTS_SIZE", {coef_msg, str_nang});
         file_input_error(msg, filecontext);
     }
-}
\ No newline at end of file
+}
+
+void PlateCoefficients::save(abase::BinaryWriter& writer) const {
+    writer.write(function_id);
+    writer.write(description);
+    writer.write(Ph);
+    writer.write(angles);
+    writer.write(a_phi);
+    writer.write(b_phi);
+    writer.write(c_phi);
+}
+
+void PlateCoefficients::load(abase::BinaryReader& reader) {
+    reader.read(function_id);
+    reader.read(description);
+    reader.read(Ph);
+    reader.read(angles);
+    reader.read(a_phi);
+    reader.read(b_phi);
+    reader.read(c_phi);
+}
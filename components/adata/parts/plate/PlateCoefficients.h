@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BinaryArchive.h"
 #include "Commands.h"
 #include "Environment.h"
 #include "FileReader.h"
@@ -39,7 +40,14 @@ namespace adata::parts {
             void init(const std::shared_ptr<abase::BaseCommand>& command);
             /// @brief Verify the coherence of object values
             /// @param filecontext file content
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
+
+            /// @brief Write the object in a binary snapshot
+            /// @param writer binary writer
+            void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the object from a binary snapshot
+            /// @param reader binary reader
+            void load(abase::BinaryReader& reader);
     };
 
 
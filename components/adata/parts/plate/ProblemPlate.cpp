@@ -90,7 +90,7 @@ void ProblemPlate::init(const std::shared_ptr<abase::BaseCommand>& command, std:
 
 }
 
-void ProblemPlate::verify(const std::string& filecontext) const {
+void ProblemPlate::verify(const abase::FileContext& filecontext) const {
     // check if the subcase of the plate is defined
     if (category == 2 && sub_case.empty()) {
         std::string msg = translate("ERROR_PLATE_UNDEFINED_SUBCASE");
@@ -117,7 +117,7 @@ void ProblemPlate::verify(const std::string& filecontext) const {
 
 }
 
-void ProblemPlate::verify_phi(const std::string& filecontext) const {
+void ProblemPlate::verify_phi(const abase::FileContext& filecontext) const {
     for (const auto& v : get_3Sm_angles()) {
         auto it = std::find(phi.values.begin(), phi.values.end(), v);
         if (it == phi.values.end()) {
@@ -127,7 +127,7 @@ void ProblemPlate::verify_phi(const std::string& filecontext) const {
     }
 }
 
-void ProblemPlate::verify_user_coefficients(const std::string& filecontext) const {
+void ProblemPlate::verify_user_coefficients(const abase::FileContext& filecontext) const {
     // check if the user coefficients are defined for category 2 analysis
     if (category != 2 || user_coefficients.angles.empty()) return;
 
@@ -29,11 +29,11 @@ namespace adata::parts {
         private :
             /// @brief control the coherence between \f$ \phi \f$ and remarkable angles
             /// @param filecontext file context
-            void verify_phi(const std::string& filecontext) const;
+            void verify_phi(const abase::FileContext& filecontext) const;
 
             /// @brief control the coherence between user's relocalization coefficients
             /// @param filecontext file context
-            void verify_user_coefficients(const std::string& filecontext) const;
+            void verify_user_coefficients(const abase::FileContext& filecontext) const;
 
             /// @brief Initialize the object dedicated to user's relocalizaztion coefficients with the values read
             /// from the input file
@@ -74,7 +74,7 @@ namespace adata::parts {
             void init(const std::shared_ptr<abase::BaseCommand>& command, std::size_t category);
             /// @brief Verify the coherence of object values
             /// @param filecontext file content
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
 
             /// @brief Return the \f$ \phi \f$ angles used for 3 Sm analysis or primary stress analysis
             /// @return 3 Sm angles
@@ -6,17 +6,27 @@
 using namespace adata::parts;
 
 RelocalisationFunction::RelocalisationFunction(const PlateCoefficients& plate_coef) {
-    _coefficients_["a_phi"] = amath::Table(plate_coef.angles, plate_coef.a_phi);
-    _coefficients_["b_phi"] = amath::Table(plate_coef.angles, plate_coef.b_phi);
-    _coefficients_["c_phi"] = amath::Table(plate_coef.angles, plate_coef.c_phi);
+    set_coefficients(plate_coef.angles, plate_coef.a_phi, plate_coef.b_phi, plate_coef.c_phi);
 }
 
-double RelocalisationFunction::get_relocalization_coef(const double& angle, const std::string& type) const {
-    auto it = _coefficients_.find(type);
-    if (it == _coefficients_.end()) {
-        error(translate("UNKNOWN_RELOCALIZATION_COEFFICIENT", type));
+RelocalisationCoefficient RelocalisationFunction::coefficient_type(const std::string& type) {
+    if (type == "a_phi") return RelocalisationCoefficient::A_PHI;
+    if (type == "b_phi") return RelocalisationCoefficient::B_PHI;
+    if (type != "c_phi") error(translate("UNKNOWN_RELOCALIZATION_COEFFICIENT", type));
+    return RelocalisationCoefficient::C_PHI;
+}
+
+std::size_t RelocalisationFunction::get_interval(double angle) const {
+    if (_angles_.size() < 2 || !(angle >= _angles_.front() && angle <= _angles_.back())) {
+        throw std::runtime_error("Invalid abciss value");
     }
-    return it->second.get_yvalue(angle, "linear");
+    // first interval [angle_i, angle_i+1] containing the angle
+    auto it = std::lower_bound(_angles_.begin() + 1, _angles_.end(), angle);
+    return static_cast<std::size_t>(it - _angles_.begin()) - 1;
+}
+
+double RelocalisationFunction::get_relocalization_coef(const double& angle, const std::string& type) const {
+    return get_coef(coefficient_type(type), angle);
 }
 
 void RelocalisationFunction::build_relocalisation_function(const double& ph, const PlateCoefficients& coef1,
@@ -29,20 +39,27 @@ void RelocalisationFunction::build_relocalisation_function(const double& ph, con
 
     RelocalisationFunction reloc_f1(coef1);
     RelocalisationFunction reloc_f2(coef2);
+    reloc_f1.set_type(_type_);
+    reloc_f2.set_type(_type_);
     reloc_f1.set_periodic_conditions();
     reloc_f2.set_periodic_conditions();
 
-    set_a_phi(merged_angles, build_interpolated_values("a_phi", reloc_f1, reloc_f2, merged_angles, ph_ratio));
-    set_b_phi(merged_angles, build_interpolated_values("b_phi", reloc_f1, reloc_f2, merged_angles, ph_ratio));
-    set_c_phi(merged_angles, build_interpolated_values("c_phi", reloc_f1, reloc_f2, merged_angles, ph_ratio));
+    std::vector<double> a_phi = build_interpolated_values(RelocalisationCoefficient::A_PHI, reloc_f1, reloc_f2,
+                                                          merged_angles, ph_ratio);
+    std::vector<double> b_phi = build_interpolated_values(RelocalisationCoefficient::B_PHI, reloc_f1, reloc_f2,
+                                                          merged_angles, ph_ratio);
+    std::vector<double> c_phi = build_interpolated_values(RelocalisationCoefficient::C_PHI, reloc_f1, reloc_f2,
+                                                          merged_angles, ph_ratio);
+    set_coefficients(std::move(merged_angles), std::move(a_phi), std::move(b_phi), std::move(c_phi));
 }
 
-std::vector<double> RelocalisationFunction::build_interpolated_values(const std::string& coef_type, 
-                                                                      const RelocalisationFunction& reloc_f1, 
-                                                                      const RelocalisationFunction& reloc_f2, 
-                                                                      std::vector<double>& merged_angles, 
+std::vector<double> RelocalisationFunction::build_interpolated_values(RelocalisationCoefficient coef_type,
+                                                                      const RelocalisationFunction& reloc_f1,
+                                                                      const RelocalisationFunction& reloc_f2,
+                                                                      const std::vector<double>& merged_angles,
                                                                       double ph_ratio) const {
     std::vector<double> interpolated_values;
+    interpolated_values.reserve(merged_angles.size());
 
     // interpolate values
     for (const auto &angle : merged_angles) {
@@ -53,89 +70,113 @@ std::vector<double> RelocalisationFunction::build_interpolated_values(const std:
     return interpolated_values;
 }
 
-void RelocalisationFunction::set_a_phi(std::vector<double> angles, std::vector<double> coefs) {
-    _coefficients_["a_phi"] = amath::Table(angles, coefs);
-}
-
-void RelocalisationFunction::set_b_phi(std::vector<double> angles, std::vector<double> coefs) {
-    _coefficients_["b_phi"] = amath::Table(angles, coefs);
-}
-
-void RelocalisationFunction::set_c_phi(std::vector<double> angles, std::vector<double> coefs) {
-    _coefficients_["c_phi"] = amath::Table(angles, coefs);
+void RelocalisationFunction::set_coefficients(std::vector<double> angles, std::vector<double> a_phi,
+                                              std::vector<double> b_phi, std::vector<double> c_phi) {
+    _angles_ = std::move(angles);
+    _values_[static_cast<std::size_t>(RelocalisationCoefficient::A_PHI)] = std::move(a_phi);
+    _values_[static_cast<std::size_t>(RelocalisationCoefficient::B_PHI)] = std::move(b_phi);
+    _values_[static_cast<std::size_t>(RelocalisationCoefficient::C_PHI)] = std::move(c_phi);
+    for (const auto& values : _values_) {
+        if (values.size() != _angles_.size()) throw std::invalid_argument("Invalid number of relocalisation coefficients");
+    }
+    if (std::is_sorted(_angles_.begin(), _angles_.end())) return;
+
+    // sort the angles with their coefficients
+    std::vector<std::size_t> order(_angles_.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t i, std::size_t j) { return _angles_[i] < _angles_[j]; });
+    std::vector<double> sorted(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i) sorted[i] = _angles_[order[i]];
+    _angles_.swap(sorted);
+    for (auto& values : _values_) {
+        for (std::size_t i = 0; i < order.size(); ++i) sorted[i] = values[order[i]];
+        values.swap(sorted);
+    }
 }
 
-double RelocalisationFunction::get_a_phi(const double& angle) const {
-    return get_relocalization_coef(angle, "a_phi");
+double RelocalisationFunction::get_coef(const std::string& type, const double& angle) const {
+    return get_relocalization_coef(angle, type);
 }
 
-double RelocalisationFunction::get_b_phi(const double& angle) const {
-    return get_relocalization_coef(angle, "b_phi");
+double RelocalisationFunction::get_coef(RelocalisationCoefficient type, double angle) const {
+    std::size_t i = get_interval(angle);
+    const std::vector<double>& values = _values_[static_cast<std::size_t>(type)];
+    double slope = (values[i + 1] - values[i]) / (_angles_[i + 1] - _angles_[i]);
+    return values[i] + slope * (angle - _angles_[i]);
 }
 
-double RelocalisationFunction::get_c_phi(const double& angle) const {
-    return get_relocalization_coef(angle, "c_phi");
+RelocalisationFunction RelocalisationFunction::sample(const std::vector<double>& angles) const {
+    RelocalisationFunction sampled;
+    sampled._type_ = _type_;
+    sampled._angles_ = angles;
+    for (std::size_t type = 0; type < NB_RELOCALISATION_COEFFICIENTS; ++type) {
+        auto& values = sampled._values_[type];
+        values.reserve(angles.size());
+        for (double angle : angles) values.push_back(get_coef(static_cast<RelocalisationCoefficient>(type), angle));
+    }
+    return sampled;
 }
 
-double RelocalisationFunction::get_coef(const std::string& type, const double& angle) const {
-    return get_relocalization_coef(angle, type);
+std::shared_ptr<RelocalisationFunction> RelocalisationFunction::clone() const {
+    return std::make_shared<RelocalisationFunction>(*this);
 }
 
+void RelocalisationFunction::add_symmetric_values(double period, double c_sign) {
+    std::size_t nb_angles = _angles_.size();
+
+    // symmetric angles in increasing order, with the values of their original angles
+    std::vector<double> sym_angles(nb_angles);
+    std::array<std::vector<double>, NB_RELOCALISATION_COEFFICIENTS> sym_values;
+    for (auto& values : sym_values) values.resize(nb_angles);
+    for (std::size_t k = 0; k < nb_angles; ++k) {
+        double angle = _angles_[nb_angles - 1 - k];
+        sym_angles[k] = period - angle;
+        for (std::size_t type = 0; type < NB_RELOCALISATION_COEFFICIENTS; ++type) {
+            sym_values[type][k] = _values_[type][nb_angles - 1 - k];
+        }
+        sym_values[static_cast<std::size_t>(RelocalisationCoefficient::C_PHI)][k] *= c_sign;
+    }
 
-std::shared_ptr<RelocalisationFunction> RelocalisationFunction::clone() const {
-    std::shared_ptr<RelocalisationFunction> clone = std::make_shared<RelocalisationFunction>();
-    for (const auto& coef : _coefficients_) {
-        clone->_coefficients_[coef.first] = amath::Table(coef.second);
+    // merge the two sorted lists, the current values are kept for the common angles
+    std::vector<double> angles;
+    std::array<std::vector<double>, NB_RELOCALISATION_COEFFICIENTS> values;
+    angles.reserve(2 * nb_angles);
+    for (auto& list : values) list.reserve(2 * nb_angles);
+
+    std::size_t i = 0, j = 0;
+    while (i < nb_angles || j < nb_angles) {
+        bool take_current = j == nb_angles || (i < nb_angles && _angles_[i] <= sym_angles[j]);
+        if (take_current && j < nb_angles && _angles_[i] == sym_angles[j]) ++j;
+        angles.push_back(take_current ? _angles_[i] : sym_angles[j]);
+        for (std::size_t type = 0; type < NB_RELOCALISATION_COEFFICIENTS; ++type) {
+            values[type].push_back(take_current ? _values_[type][i] : sym_values[type][j]);
+        }
+        if (take_current) ++i; else ++j;
     }
-    return clone;
+
+    _angles_ = std::move(angles);
+    _values_ = std::move(values);
 }
 
-void RelocalisationFunction::set_periodic_conditions_up() {  
-    if (_coefficients_.begin()->second.get_xmax() > 90.) return;
+void RelocalisationFunction::set_periodic_conditions_up() {
+    if (_angles_.empty() || _angles_.back() > 90.) return;
 
     // a_phi and b_phi are symmetric between [0, 90] and [90, 180]
     // c_phi is anti-symmetric between between [0, 90] and [90, 180]
-    std::vector<double> angles = get_angles();
-    std::reverse(angles.begin(), angles.end());
-
-    std::vector<double> sym_angles;
-    std::vector<double> sym_a_phi, sym_b_phi, sym_c_phi;
-    for (const auto& angle : angles) {
-        sym_angles.push_back(180. - angle);
-        sym_a_phi.push_back(_coefficients_["a_phi"].get_yvalue(angle, "linear"));
-        sym_b_phi.push_back(_coefficients_["b_phi"].get_yvalue(angle, "linear"));
-        sym_c_phi.push_back(-1.*_coefficients_["c_phi"].get_yvalue(angle, "linear"));
-    }
-    _coefficients_["a_phi"].expand(sym_angles, sym_a_phi);
-    _coefficients_["b_phi"].expand(sym_angles, sym_b_phi);
-    _coefficients_["c_phi"].expand(sym_angles, sym_c_phi);
-
+    add_symmetric_values(180., -1.);
 }
 
-void RelocalisationFunction::set_periodic_conditions_down() {  
-    if (_coefficients_.begin()->second.get_xmax() > 180.) return;
+void RelocalisationFunction::set_periodic_conditions_down() {
+    if (_angles_.empty() || _angles_.back() > 180.) return;
 
     // a_phi, b_phi and c_phi are symmetric between [0, 180] and [180, 360]
-    std::vector<double> angles = get_angles();
-    std::reverse(angles.begin(), angles.end());
-
-    std::vector<double> sym_angles;
-    std::vector<double> sym_a_phi, sym_b_phi, sym_c_phi;
-    for (const auto& angle : angles) {
-        sym_angles.push_back(360. - angle);
-        sym_a_phi.push_back(_coefficients_["a_phi"].get_yvalue(angle, "linear"));
-        sym_b_phi.push_back(_coefficients_["b_phi"].get_yvalue(angle, "linear"));
-        sym_c_phi.push_back(_coefficients_["c_phi"].get_yvalue(angle, "linear"));
-    }
-    _coefficients_["a_phi"].expand(sym_angles, sym_a_phi);
-    _coefficients_["b_phi"].expand(sym_angles, sym_b_phi);
-    _coefficients_["c_phi"].expand(sym_angles, sym_c_phi);
+    add_symmetric_values(360., 1.);
 }
 
 
 void RelocalisationFunction::set_periodic_conditions() {
     if (_type_.empty()) throw std::invalid_argument("Cannot set_periodic_conditions for empty type !");
-    
+
     // Complete coefficients for angles between [90, 180] based on [0, 90]
     set_periodic_conditions_up();
 
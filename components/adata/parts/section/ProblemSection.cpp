@@ -13,7 +13,7 @@ void StressCoefficientContainer::init(const std::shared_ptr<abase::BaseCommand>&
     bt.init(command);
 }
 
-void StressCoefficientContainer::verify(const std::string& filecontext) const {
+void StressCoefficientContainer::verify(const abase::FileContext& filecontext) const {
     pk.verify(filecontext);
     kf.verify(filecontext);
     km.verify(filecontext);
@@ -107,15 +107,15 @@ void ProblemSection::init(const std::shared_ptr<abase::BaseCommand>& command, st
     set_special_parameters(command);
 }
 
-void ProblemSection::verify(const std::string& filecontext) const {
+void ProblemSection::verify(const abase::FileContext& filecontext) const {
     if (fem_rank == UNDEFINED_SIZE_T && name.empty()) {
         std::string msg = translate("ERROR_SECTION_MISSING_ID");
-        file_input_error(filecontext, msg);
+        file_input_error(msg, filecontext);
     }
 
     if (fem_rank != UNDEFINED_SIZE_T && name.size() > 0) {
         std::string msg = translate("ERROR_SECTION_BOTH_ID_NAME", {std::to_string(fem_rank), name});
-        file_input_error(filecontext, msg);
+        file_input_error(msg, filecontext);
     }
 
     stress_coefficients.verify(filecontext);
@@ -25,7 +25,7 @@ namespace adata::parts {
         /// @param command command read from the input file
         void init(const std::shared_ptr<abase::BaseCommand>& command);
         /// @brief Verify the coherence of each coefficient
-        void verify(const std::string& filecontext) const;
+        void verify(const abase::FileContext& filecontext) const;
     };
 
     class ProblemSection {
@@ -92,6 +92,10 @@ namespace adata::parts {
 
             ProblemSection() = default;
             virtual ~ProblemSection() = default;
+            ProblemSection(const ProblemSection&) = default;
+            ProblemSection(ProblemSection&&) = default;
+            ProblemSection& operator=(const ProblemSection&) = default;
+            ProblemSection& operator=(ProblemSection&&) = default;
 
             /// @brief Initialize the object with the values read from the input file
             /// @param command command read from the input file
@@ -99,7 +103,7 @@ namespace adata::parts {
             /// @param category category of the problem (used for futher verification)
             void init(const std::shared_ptr<abase::BaseCommand>& command, std::size_t id, std::size_t category);
             /// @brief Verify the coherence of the material definition
-            void verify(const std::string& filecontext) const;
+            void verify(const abase::FileContext& filecontext) const;
 
     };
 }
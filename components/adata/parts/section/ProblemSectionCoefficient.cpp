@@ -11,10 +11,10 @@ void StressCoefficient::init(const std::shared_ptr<abase::BaseCommand>& command)
     set_default_values();
 }
 
-void StressCoefficient::verify(const std::string& filecontext) const {
+void StressCoefficient::verify(const abase::FileContext& filecontext) const {
     if (values.size() != expected_size) {
         std::string msg = translate("ERROR_SECTION_COEFFICIENTS", {name, std::to_string(expected_size)});
-        file_input_error(filecontext, msg);
+        file_input_error(msg, filecontext);
     }
 }
 
@@ -28,7 +28,7 @@ namespace adata::parts {
             /// @param command command read from the input file
             virtual void init(const std::shared_ptr<abase::BaseCommand>& command);
             /// @brief Verify the coherence of the material definition
-            virtual void verify(const std::string& filecontext) const;
+            virtual void verify(const abase::FileContext& filecontext) const;
     };
 
     class PKCoefficient : public StressCoefficient {
@@ -26,7 +26,7 @@ void ProblemTable::init(const std::shared_ptr<abase::BaseCommand>& command, std:
 
 }
 
-void ProblemTable::verify(const std::string& filecontext) const {
+void ProblemTable::verify(const abase::FileContext& filecontext) const {
     // check if the table abciss is ordered
     std::vector<double> abciss = table.get_xrange();
     if (!std::is_sorted(abciss.begin(), abciss.end())) {
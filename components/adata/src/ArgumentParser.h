@@ -29,7 +29,8 @@ namespace adata {
                 "--multi", "--mpi", "--optimize", "--verbose", "--max_load_set_cat2"
             };
             std::vector<std::string> boolean_options = { 
-                "--no_omp_nested", "--only_min_max_torseur", "--compatibility", "--plate_compatibility" 
+                "--no_omp_nested", "--only_min_max_torseur", "--compatibility", "--plate_compatibility",
+                "--deterministic", "--pipeline"
             };
 
         public:
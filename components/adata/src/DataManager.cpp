@@ -2,7 +2,7 @@
 
 using namespace adata;
 
-void DataManager::set_data(const std::shared_ptr<abase::BaseCommand>& command, const std::string& filecontext) {
+void DataManager::set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext) {
     std::string name = command->get_name();
 
     if (name == "FEM_FILE") {
@@ -29,7 +29,10 @@ void DataManager::set_data(const std::shared_ptr<abase::BaseCommand>& command, c
         ProblemLoadstep loadstep;
         loadstep.init(command, torsor.cards.size());
         loadstep.verify(filecontext);
-        loadsteps.push_back(loadstep);
+        loadsteps.push_back(std::move(loadstep));
+        if (pipeline != nullptr) {
+            pipeline->push({&loadsteps.back(), nullptr, loadsteps.size() - 1});
+        }
     }
 
     if (name == "TRANSIENT") {
@@ -57,7 +60,10 @@ void DataManager::set_data(const std::shared_ptr<abase::BaseCommand>& command, c
         ProblemSection section;
         section.init(command, sections.size(), description.category);
         section.verify(filecontext);
-        sections.push_back(section);
+        sections.push_back(std::move(section));
+        if (pipeline != nullptr) {
+            pipeline->push({nullptr, &sections.back(), sections.size() - 1});
+        }
     }
 
 }
@@ -125,4 +131,11 @@ const ProblemTransient& DataManager::get_transient(const std::size_t rank) const
         error(translate("CANNOT_FIND_TRANSIENT_BY_RANK", std::to_string(rank)));
     }
     return transients[rank];
-}
\ No newline at end of file
+}
+
+const ProblemLoadstep& DataManager::get_loadstep(const std::size_t rank) const {
+    if (rank >= loadsteps.size()) {
+        error(translate("CANNOT_FIND_LOADSTEP_BY_RANK", std::to_string(rank)));
+    }
+    return loadsteps[rank];
+}
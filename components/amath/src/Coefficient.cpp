@@ -10,17 +10,35 @@ Coefficient::Coefficient(const Table& table) {
 
 Coefficient::Coefficient(const Coefficient& coefficient) {
     _table_ = coefficient._table_;
+    _compiled_ = coefficient._compiled_;
 }
 
 Coefficient& Coefficient::operator=(const Coefficient& coefficient) {
     if (this != &coefficient) {
         _table_ = coefficient._table_;
+        _compiled_ = coefficient._compiled_;
     }
     return *this;
 }
 
+LinearCoefficient& LinearCoefficient::operator=(const LinearCoefficient& other) {
+    Coefficient::operator=(other);
+    return *this;
+}
+
+LogarithmicCoefficient& LogarithmicCoefficient::operator=(const LogarithmicCoefficient& other) {
+    Coefficient::operator=(other);
+    return *this;
+}
+
+ConstantCoefficient& ConstantCoefficient::operator=(const ConstantCoefficient& other) {
+    Coefficient::operator=(other);
+    return *this;
+}
+
 ConstantCoefficient::ConstantCoefficient(double value) {
     std::vector<double> xvalues = {std::numeric_limits<double>::min(), std::numeric_limits<double>::max()};
     std::vector<double> yvalues = {value, value};
     _table_ = Table(xvalues, yvalues);
+    compile("linear");
 }
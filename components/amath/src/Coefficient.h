@@ -1,5 +1,6 @@
 #pragma once
 
+#include "CompiledTable.h"
 #include "Table.h"
 
 namespace amath {
@@ -12,6 +13,13 @@ namespace amath {
         protected:
             /// \brief Internal table used to store data associated to the coefficient.
             Table _table_;
+            /// \brief Table of the coefficient compiled for repeated interpolations of y-values (see `compile`).
+            CompiledTable _compiled_;
+
+            /// \brief Compile the table of the coefficient with the interpolation method of the derived class. It is
+            /// called once by the constructors of the derived classes, after the table is set.
+            /// \param[in] method The interpolation method: "linear" or "logarithmic".
+            void compile(const std::string& method) { _compiled_ = CompiledTable(_table_, method); }
 
         public:
 
@@ -28,6 +36,16 @@ namespace amath {
             virtual double get_yvalue(double x) const = 0;
             /// \brief Pure virtual function used to return the x-value of the coefficient at a given y-value.
             virtual double get_xvalue(double y) const = 0;
+            /// \brief Return the table of the coefficient compiled for repeated interpolations of y-values.
+            const CompiledTable& get_compiled() const { return _compiled_; }
+
+            /// \brief Return true if the table of the coefficient is defined.
+            bool is_defined() const { return _table_.size() > 0; }
+            /// \brief Return the y-values of the coefficient at several x-values. The y-values of the x-values
+            /// outside the table are set to NaN.
+            /// \param[in] x The x-values.
+            /// \param[out] y The y-values.
+            void get_yvalues(const std::vector<double>& x, std::vector<double>& y) const { _compiled_.get_yvalues(x, y); }
     };
 
     /// \brief Represents a coefficient depending on a parameter. A linear interpolation is used to compute the 
@@ -38,9 +56,9 @@ namespace amath {
             /// \brief Default constructor for the LinearCoefficient class.
             LinearCoefficient() = default;
             /// \brief Constructor for the LinearCoefficient class with a given table.
-            LinearCoefficient(const Table& table) : Coefficient(table) {};
+            LinearCoefficient(const Table& table) : Coefficient(table) { compile("linear"); };
             /// \brief Copy constructor for the LinearCoefficient class.
-            LinearCoefficient(const Coefficient& coefficient) : Coefficient(coefficient) {};
+            LinearCoefficient(const Coefficient& coefficient) : Coefficient(coefficient) { compile("linear"); };
             /// \brief Copy assignment operator for the LinearCoefficient class.
             LinearCoefficient& operator=(const LinearCoefficient& other);
 
@@ -60,9 +78,9 @@ namespace amath {
             /// \brief Default constructor for the LogarithmicCoefficient class.
             LogarithmicCoefficient() = default;
             /// \brief Constructor for the LogarithmicCoefficient class with a given table.
-            LogarithmicCoefficient(const Table& table) : Coefficient(table) {};
+            LogarithmicCoefficient(const Table& table) : Coefficient(table) { compile("logarithmic"); };
             /// \brief Copy constructor for the LogarithmicCoefficient class.
-            LogarithmicCoefficient(const Coefficient& coefficient) : Coefficient(coefficient) {};
+            LogarithmicCoefficient(const Coefficient& coefficient) : Coefficient(coefficient) { compile("logarithmic"); };
             /// \brief Copy assignment operator for the LogarithmicCoefficient class.
             LogarithmicCoefficient& operator=(const LogarithmicCoefficient& other);
 
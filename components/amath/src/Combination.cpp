@@ -13,32 +13,28 @@ using namespace amath;
 // Combination methods
 //
 Combination::Combination(const std::vector<std::size_t>& ranks) {
-    this->ranks = ranks;
-    sort_ranks();
+    // count the distinct ranks
+    std::vector<std::size_t> sorted_ranks = ranks;
+    std::sort(sorted_ranks.begin(), sorted_ranks.end());
+    nb_ranks = static_cast<std::size_t>(std::unique(sorted_ranks.begin(), sorted_ranks.end()) - sorted_ranks.begin());
 }
 
 Combination::Combination(const std::vector<std::size_t>& rks_1, const std::vector<std::size_t>& rks_2) {
-    this->ranks = rks_1;
-    this->ranks.insert(this->ranks.end(), rks_2.begin(), rks_2.end());
+    nb_ranks = rks_1.size() + rks_2.size();
 }
 
 Combination::Combination(const Combination& combination) {
-    this->ranks = combination.ranks;
+    this->nb_ranks = combination.nb_ranks;
 }
 
 Combination& Combination::operator=(const Combination& combination) {
     if (this != &combination) {
-        this->ranks = combination.ranks;
+        this->nb_ranks = combination.nb_ranks;
     }
     set_cached_size();
     return *this;
 }
 
-void Combination::sort_ranks() {
-    std::sort(this->ranks.begin(), this->ranks.end());
-    this->ranks.erase(std::unique(this->ranks.begin(), this->ranks.end()), this->ranks.end());
-}
-
 //
 // RectangularCombination methods
 //
@@ -56,9 +52,15 @@ RectangularCombination::RectangularCombination(const std::vector<std::size_t>& r
     set_cached_size();
 }
 
+RectangularCombination::RectangularCombination(std::size_t rows, std::size_t columns) : Combination(rows + columns) {
+    nb_rows = rows;
+    nb_columns = columns;
+    set_cached_size();
+}
+
 RectangularCombination& RectangularCombination::operator=(const RectangularCombination& combination) {
     if (this != &combination) {
-        this->ranks = combination.ranks;
+        this->nb_ranks = combination.nb_ranks;
         this->nb_rows = combination.nb_rows;
         this->nb_columns = combination.nb_columns;
     }
@@ -86,6 +88,10 @@ TriangularCombination::TriangularCombination(const std::vector<std::size_t>& ran
                                                          : Combination(ranks) { 
     set_type(on_diag); 
 }
+TriangularCombination::TriangularCombination(std::size_t nb_distinct_ranks, bool on_diag)
+                                                         : Combination(nb_distinct_ranks) { 
+    set_type(on_diag); 
+}
 TriangularCombination::TriangularCombination(const TriangularCombination& combination, bool on_diag)
                                                          : Combination(combination) { 
     set_type(on_diag);
@@ -97,7 +103,7 @@ void TriangularCombination::set_type(bool on_diag) {
 }
 
 void TriangularCombination::set_cached_size() {
-    std::size_t n = ranks.size();
+    std::size_t n = nb_ranks;
     
     // check maximum number represented by std::size_t and compare it to the number of combinations
     double max_comb = get_type() ? n * (n + 1) / 2 : n * (n - 1) / 2;
@@ -111,7 +117,7 @@ void TriangularCombination::set_cached_size() {
 
 TriangularCombination& TriangularCombination::operator=(const TriangularCombination& combination) {
     if (this != &combination) {
-        this->ranks = combination.ranks;
+        this->nb_ranks = combination.nb_ranks;
     }
     set_cached_size();
     set_type( combination.get_type() );
@@ -131,7 +137,7 @@ constexpr std::size_t TriangularCombination::line_for_combination(const std::siz
 }
 
 std::size_t TriangularCombination::operator()(const std::size_t& row, const std::size_t& column) const {
-    std::size_t n = ranks.size();
+    std::size_t n = nb_ranks;
     std::size_t p = std::min(row, column);
     std::size_t q = std::max(row, column);
     return combination_for_line(p, n) + q - n;
@@ -144,7 +150,7 @@ combi_ranks TriangularCombination::get_ranks(const std::size_t& combination) con
 }
 
 void TriangularCombination::ranks_by_ptr(const std::size_t& combination, combi_ranks& ranks) const {
-    std::size_t n = this->ranks.size();
+    std::size_t n = this->nb_ranks;
     std::size_t p = line_for_combination(combination, n);
     std::size_t q = n + combination - combination_for_line(p, n);
     if (p >= n || q >= n) {
@@ -22,20 +22,21 @@ namespace amath {
      */
     class Combination {
         protected:
-            /// \brief Vector of ranks.
-            std::vector<std::size_t> ranks;
+            /// \brief Number of ranks (only the number of ranks is needed to explore the combinations).
+            std::size_t nb_ranks = 0;
             /// \brief  The number of possible combinations
             std::size_t cached_size;        
         private:
-            /// \brief Function used to order ranks and suppress duplicates.
-            void sort_ranks();
             /// \brief  Store the number of combinations
             virtual void set_cached_size() = 0;
 
         public:
             /// \brief Constructor.
-            /// \param ranks Vector of ranks.
+            /// \param ranks Vector of ranks (duplicated ranks are counted once).
             Combination(const std::vector<std::size_t>& ranks);
+            /// \brief Constructor based on the number of distinct ranks.
+            /// \param nb_distinct_ranks Number of distinct ranks.
+            explicit Combination(std::size_t nb_distinct_ranks) : nb_ranks(nb_distinct_ranks) {};
             /// \brief Constructor based on 2 vector of ranks.
             /// \param rks_1 First vector of ranks.
             /// \param rks_2 Second vector of ranks.
@@ -101,6 +102,10 @@ namespace amath {
             /// \param rks_1 First vector of ranks.
             /// \param rks_2 Second vector of ranks.
             RectangularCombination(const std::vector<std::size_t>& rks_1, const std::vector<std::size_t>& rks_2);
+            /// \brief Constructor based on the number of ranks of each vector.
+            /// \param rows Number of ranks of the first vector.
+            /// \param columns Number of ranks of the second vector.
+            RectangularCombination(std::size_t rows, std::size_t columns);
             /// \brief Copy constructor.
             /// \param combination Combination to copy.
             RectangularCombination(const RectangularCombination& combination);
@@ -189,6 +194,10 @@ namespace amath {
             /// \param ranks Vector of ranks.
             /// \param on_diag boolean for use or not of the diagonal
             TriangularCombination(const std::vector<std::size_t>& ranks, bool on_diag = false);
+            /// \brief Constructor based on the number of distinct ranks.
+            /// \param nb_distinct_ranks Number of distinct ranks.
+            /// \param on_diag boolean for use or not of the diagonal
+            TriangularCombination(std::size_t nb_distinct_ranks, bool on_diag = false);
             /// \brief Copy constructor.
             /// \param combination Combination to copy.
             /// \param on_diag boolean for use or not of the diagonal
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+#include "CompiledTable.h"
+
+using namespace amath;
+
+CompiledTable::CompiledTable(const Table& table, const std::string& method) : _table_(table), _method_(method) {
+    if (method != "linear" && method != "logarithmic") throw std::runtime_error("Invalid interpolation method");
+    if (table.size() == 0) throw std::runtime_error("Table is empty");
+
+    std::vector<double> x = table.get_xvalues();
+    std::vector<double> y = table.get_yvalues();
+    _decreasing_ = !std::is_sorted(x.begin(), x.end()) && std::is_sorted(x.rbegin(), x.rend());
+    _sorted_ = _decreasing_ || std::is_sorted(x.begin(), x.end());
+    if (!_sorted_) return;
+
+    xmin = std::min(x.front(), x.back());
+    xmax = std::max(x.front(), x.back());
+    xorigins = x;
+    if (method == "logarithmic") {
+        xmin = std::max(xmin, 0.);
+        for (auto& v : xorigins) v = std::log(v);
+        for (auto& v : y) v = std::log(v);
+    }
+    slopes.resize(x.size() > 1 ? x.size() - 1 : 0);
+    for (std::size_t i = 0; i < slopes.size(); ++i) {
+        slopes[i] = (y[i + 1] - y[i]);
+        slopes[i] /= (xorigins[i + 1] - xorigins[i]);
+    }
+    xvalues = std::move(x);
+    yvalues = std::move(y);
+    // a table with a single value has no interval
+    if (slopes.empty()) xmax = std::nextafter(xmin, -std::numeric_limits<double>::infinity());
+}
+
+std::size_t CompiledTable::get_interval(double x) const {
+    auto it = _decreasing_ ? std::lower_bound(xvalues.begin() + 1, xvalues.end(), x, std::greater<double>())
+                           : std::lower_bound(xvalues.begin() + 1, xvalues.end(), x);
+    return static_cast<std::size_t>(it - xvalues.begin()) - 1;
+}
+
+double CompiledTable::get_yvalue(double x) const {
+    if (!_sorted_) return _table_.get_yvalue(x, _method_);
+    if (!is_valid(x)) throw std::runtime_error("Invalid abciss value");
+
+    std::size_t i = get_interval(x);
+    if (_method_ == "linear") return yvalues[i] + slopes[i] * (x - xorigins[i]);
+    return std::exp(yvalues[i] + slopes[i] * (std::log(x) - xorigins[i]));
+}
+
+void CompiledTable::get_yvalues(const std::vector<double>& x, std::vector<double>& y) const {
+    y.resize(x.size());
+    if (!_sorted_) {
+        for (std::size_t k = 0; k < x.size(); ++k) {
+            try {
+                y[k] = _table_.get_yvalue(x[k], _method_);
+            } catch (const std::runtime_error&) {
+                y[k] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+        return;
+    }
+    if (slopes.empty()) {
+        std::fill(y.begin(), y.end(), std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+
+    // search the intervals, then interpolate with contiguous loads (vectorisable loops)
+    std::vector<std::size_t> intervals(x.size(), 0);
+    std::vector<double> abciss(x);
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        if (is_valid(x[k])) intervals[k] = get_interval(x[k]);
+        else abciss[k] = std::numeric_limits<double>::quiet_NaN();
+    }
+    if (_method_ == "logarithmic") {
+        for (std::size_t k = 0; k < abciss.size(); ++k) abciss[k] = std::log(abciss[k]);
+    }
+    for (std::size_t k = 0; k < abciss.size(); ++k) {
+        std::size_t i = intervals[k];
+        y[k] = yvalues[i] + slopes[i] * (abciss[k] - xorigins[i]);
+    }
+    if (_method_ == "logarithmic") {
+        for (std::size_t k = 0; k < y.size(); ++k) y[k] = std::exp(y[k]);
+    }
+}
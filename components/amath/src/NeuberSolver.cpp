@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "NeuberSolver.h"
+
+using namespace amath;
+
+double CyclicCurve::strain(double stress_range) const {
+    return stress_range / E + 2. * std::pow(stress_range / (2. * K), 1. / n);
+}
+
+void NeuberStatistics::merge(const NeuberStatistics& other) {
+    size += other.size;
+    iterations += other.iterations;
+    max_iterations = std::max(max_iterations, other.max_iterations);
+    warm_starts += other.warm_starts;
+    not_converged += other.not_converged;
+    undefined += other.undefined;
+}
+
+NeuberSolver::NeuberSolver(const CyclicCurve& curve) : _curve_(curve) {
+    if (curve.E <= 0. || curve.K <= 0. || curve.n <= 0.) throw std::invalid_argument("Invalid cyclic curve");
+}
+
+double NeuberSolver::initial_guess(double elastic_range) const {
+    // fully plastic solution of 2 x (x / 2K)^(1/n) = S^2 / E, bounded by the elastic solution
+    double n = _curve_.n;
+    double target = elastic_range * elastic_range / (2. * _curve_.E);
+    double plastic = std::pow(target, n / (n + 1.)) * std::pow(2. * _curve_.K, 1. / (n + 1.));
+    return std::min(elastic_range, plastic);
+}
+
+void NeuberSolver::solve(const std::vector<double>& elastic_ranges, std::size_t nb_columns,
+                         NeuberResults& results) const {
+    if (nb_columns == 0 || elastic_ranges.size() % nb_columns != 0) {
+        throw std::invalid_argument("Invalid number of columns");
+    }
+    std::size_t nb_rows = elastic_ranges.size() / nb_columns;
+    double E = _curve_.E;
+    double inv_2K = 1. / (2. * _curve_.K);
+    double inv_n = 1. / _curve_.n;
+
+    results.stress.resize(elastic_ranges.size());
+    results.strain.resize(elastic_ranges.size());
+    results.statistics = NeuberStatistics();
+    NeuberStatistics& statistics = results.statistics;
+    statistics.size = elastic_ranges.size();
+
+    // state of each row for the current column
+    std::vector<double> x(nb_rows), lower(nb_rows), upper(nb_rows), target(nb_rows);
+    std::vector<char> active(nb_rows), undefined(nb_rows);
+    std::vector<std::size_t> iterations(nb_rows);
+
+    for (std::size_t col = 0; col < nb_columns; ++col) {
+        // initial guess: warm start from the previous column of the row, or closed form
+        for (std::size_t row = 0; row < nb_rows; ++row) {
+            double S = elastic_ranges[row * nb_columns + col];
+            double previous = col > 0 ? elastic_ranges[row * nb_columns + col - 1] : 0.;
+            active[row] = S > 0.;
+            undefined[row] = !(S >= 0.);
+            iterations[row] = 0;
+            lower[row] = 0.;
+            upper[row] = std::max(S, 0.);
+            target[row] = S * S / E;
+            if (!active[row]) {
+                x[row] = undefined[row] ? std::numeric_limits<double>::quiet_NaN() : 0.;
+            } else if (previous > 0.) {
+                x[row] = std::min(results.stress[row * nb_columns + col - 1] * (S / previous), S);
+                ++statistics.warm_starts;
+            } else {
+                x[row] = initial_guess(S);
+            }
+        }
+
+        // safeguarded Newton steps on the active rows
+        for (std::size_t it = 0; it < NEUBER_MAX_ITERATIONS; ++it) {
+            bool any_active = false;
+            for (std::size_t row = 0; row < nb_rows; ++row) {
+                if (!active[row]) continue;
+                any_active = true;
+                // Newton step on g = log(x eps(x)) - log(S^2 / E) with respect to log(x)
+                double xr = x[row];
+                double plastic = 2. * std::pow(xr * inv_2K, inv_n);
+                double energy = xr * (xr / E + plastic);
+                if (energy < target[row]) lower[row] = xr; else upper[row] = xr;
+
+                double g = std::log(energy / target[row]);
+                double dg = (2. * xr / E + (1. + inv_n) * plastic) / (xr / E + plastic);
+                double next = xr * std::exp(-g / dg);
+                if (!(next >= lower[row] && next <= upper[row])) next = 0.5 * (lower[row] + upper[row]);
+                ++iterations[row];
+                active[row] = std::abs(next - xr) > NEUBER_TOLERANCE * next;
+                x[row] = next;
+            }
+            if (!any_active) break;
+        }
+
+        for (std::size_t row = 0; row < nb_rows; ++row) {
+            std::size_t k = row * nb_columns + col;
+            results.stress[k] = x[row];
+            results.strain[k] = x[row] > 0. ? _curve_.strain(x[row]) : x[row];
+            statistics.iterations += iterations[row];
+            statistics.max_iterations = std::max(statistics.max_iterations, iterations[row]);
+            if (active[row]) ++statistics.not_converged;
+            if (undefined[row]) ++statistics.undefined;
+        }
+    }
+}
+
+double NeuberSolver::solve(double elastic_range) const {
+    NeuberResults results;
+    solve(std::vector<double>{elastic_range}, 1, results);
+    return results.stress.front();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+
+namespace amath {
+
+    /// \brief Maximal number of Newton steps of the Neuber solver.
+    static constexpr std::size_t NEUBER_MAX_ITERATIONS = 12;
+    /// \brief Relative tolerance on the stress range of the Neuber solver.
+    static constexpr double NEUBER_TOLERANCE = 1e-10;
+
+    /// \brief Cyclic stress-strain curve of a material (Ramberg-Osgood law written for ranges):
+    /// \f$ \Delta\varepsilon = \frac{\Delta\sigma}{E} + 2 \left(\frac{\Delta\sigma}{2 K}\right)^{\frac{1}{n}} \f$.
+    struct CyclicCurve {
+        /// \brief Young modulus \f$ E \f$
+        double E = 0.;
+        /// \brief cyclic strength coefficient \f$ K \f$
+        double K = 0.;
+        /// \brief cyclic strain hardening exponent \f$ n \f$
+        double n = 1.;
+
+        /// \brief Return the strain range associated to a stress range.
+        double strain(double stress_range) const;
+    };
+
+    /// \brief Iteration statistics of a batch solved by NeuberSolver.
+    struct NeuberStatistics {
+        /// \brief number of solved ranges
+        std::size_t size = 0;
+        /// \brief total number of Newton steps
+        std::size_t iterations = 0;
+        /// \brief largest number of Newton steps for a range
+        std::size_t max_iterations = 0;
+        /// \brief number of ranges started from the solution of the previous range of their row
+        std::size_t warm_starts = 0;
+        /// \brief number of ranges which have not converged in NEUBER_MAX_ITERATIONS steps
+        std::size_t not_converged = 0;
+        /// \brief number of undefined elastic ranges (NaN or negative), whose results are NaN
+        std::size_t undefined = 0;
+
+        /// \brief Add the statistics of another batch.
+        void merge(const NeuberStatistics& other);
+    };
+
+    /// \brief Results of NeuberSolver (one value by elastic range).
+    struct NeuberResults {
+        /// \brief elastic-plastic stress range \f$ \Delta\sigma \f$
+        std::vector<double> stress;
+        /// \brief elastic-plastic strain range \f$ \Delta\varepsilon \f$
+        std::vector<double> strain;
+        /// \brief iteration statistics of the batch
+        NeuberStatistics statistics;
+    };
+
+    /// \brief Neuber elastic-plastic correction of elastic stress ranges for a batch of ranges.
+    ///
+    /// For an elastic range \f$ \Delta S \f$, the Neuber rule \f$ \Delta\sigma \Delta\varepsilon =
+    /// \frac{\Delta S^2}{E} \f$ is solved with the cyclic curve of the material. The ranges are given as a matrix
+    /// (for instance the pairs of a row of the interaction matrix): the rows are solved together, column by column.
+    /// The first column starts from a closed-form guess (minimum of the elastic and fully plastic solutions), the
+    /// next columns from the solution of the previous column of the row scaled by the ratio of the elastic ranges.
+    /// A fixed number of safeguarded Newton steps is applied to all the rows: the steps are done on
+    /// \f$ \log(\Delta\sigma \Delta\varepsilon) \f$ with respect to \f$ \log(\Delta\sigma) \f$ (almost linear,
+    /// even for small hardening exponents), the solution is kept in a bracket \f$ [0, \Delta S] \f$ (bisection when
+    /// the Newton step leaves it) and the converged rows are masked. A null elastic range gives null results, an
+    /// undefined elastic range (NaN or negative) gives NaN results and is counted in the statistics.
+    class NeuberSolver {
+        private:
+            /// \brief cyclic curve of the material
+            CyclicCurve _curve_;
+
+            /// \brief Return the closed-form initial guess of the stress range
+            double initial_guess(double elastic_range) const;
+
+        public:
+            /// \brief Constructor
+            /// \param curve cyclic curve of the material
+            NeuberSolver(const CyclicCurve& curve);
+
+            /// \brief Solve the Neuber rule for a matrix of elastic ranges.
+            /// \param elastic_ranges elastic stress ranges stored by row (row-major matrix)
+            /// \param nb_columns number of columns of the matrix
+            /// \param[out] results elastic-plastic ranges (same layout) and iteration statistics
+            void solve(const std::vector<double>& elastic_ranges, std::size_t nb_columns, NeuberResults& results) const;
+            /// \brief Solve the Neuber rule for a single elastic range.
+            /// \param elastic_range elastic stress range
+            /// \return elastic-plastic stress range
+            double solve(double elastic_range) const;
+    };
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "PlateAngleSearch.h"
+
+using namespace amath;
+
+namespace {
+    /// \brief Relative margin applied to the bounds of the pieces to absorb the rounding errors of the bounds
+    constexpr double BOUND_MARGIN = 1e-12;
+
+    /// \brief Return the largest component modulus of a stress tensor
+    double max_modulus(const Stress& stress) {
+        double modulus = 0.;
+        for (std::size_t i = 0; i < STRESS_SIZE; ++i) modulus = std::max(modulus, std::abs(stress[i]));
+        return modulus;
+    }
+}
+
+PlateAngleSearch::PlateAngleSearch(const std::vector<double>& knots, const std::vector<double>& a,
+                                   const std::vector<double>& b, const std::vector<double>& c,
+                                   const std::vector<double>& grid, const std::string& method) : angles(grid) {
+    if (method != "tresca" && method != "mises" && method != "reduced_mises") {
+        throw std::invalid_argument("Invalid equivalent stress method");
+    }
+    equivalent_stress_method = method;
+    if (knots.size() < 2 || a.size() != knots.size() || b.size() != knots.size() || c.size() != knots.size()) {
+        throw std::invalid_argument("Invalid relocalisation coefficients");
+    }
+    if (!std::is_sorted(knots.begin(), knots.end()) || !std::is_sorted(angles.begin(), angles.end())) {
+        throw std::invalid_argument("Angles must be sorted");
+    }
+    if (!angles.empty() && (angles.front() < knots.front() || angles.back() > knots.back())) {
+        throw std::invalid_argument("Invalid abciss value");
+    }
+
+    // coefficients of the analysis angles, interpolated on the first interval containing the angle
+    a_phi.reserve(angles.size());
+    b_phi.reserve(angles.size());
+    c_phi.reserve(angles.size());
+    for (double angle : angles) {
+        auto it = std::lower_bound(knots.begin() + 1, knots.end(), angle);
+        std::size_t i = static_cast<std::size_t>(it - knots.begin()) - 1;
+        a_phi.push_back(a[i] + (a[i + 1] - a[i]) / (knots[i + 1] - knots[i]) * (angle - knots[i]));
+        b_phi.push_back(b[i] + (b[i + 1] - b[i]) / (knots[i + 1] - knots[i]) * (angle - knots[i]));
+        c_phi.push_back(c[i] + (c[i + 1] - c[i]) / (knots[i + 1] - knots[i]) * (angle - knots[i]));
+    }
+
+    kernel = PlateStressKernel(a_phi, b_phi, c_phi, method);
+
+    // analysis angles of each interval of the coefficients
+    for (std::size_t i = 0; i + 1 < knots.size(); ++i) {
+        auto first = std::lower_bound(angles.begin(), angles.end(), knots[i]);
+        auto last = std::upper_bound(first, angles.end(), knots[i + 1]);
+        if (first == last) continue;
+        pieces.push_back({static_cast<std::size_t>(first - angles.begin()),
+                          static_cast<std::size_t>(last - angles.begin()) - 1});
+    }
+}
+
+double PlateAngleSearch::equivalent(const Stress& stress) const {
+    if (equivalent_stress_method == "mises") return stress.mises();
+    if (equivalent_stress_method == "reduced_mises") return stress.reduced_mises();
+    return stress.tresca();
+}
+
+double PlateAngleSearch::equivalent(const RelocalisedStress& stress, std::size_t rank) const {
+    return equivalent(stress.at(a_phi[rank], b_phi[rank], c_phi[rank]));
+}
+
+double PlateAngleSearch::equivalent_error() const {
+    if (equivalent_stress_method == "tresca") return TRESCA_STRESS_ERROR;
+    return MISES_STRESS_ERROR;
+}
+
+double PlateAngleSearch::norm_bound(const RelocalisedStress& stress, std::size_t piece) const {
+    std::size_t i = pieces[piece].first, j = pieces[piece].last;
+    return std::max(std::abs(a_phi[i]), std::abs(a_phi[j])) * max_modulus(stress.a)
+         + std::max(std::abs(b_phi[i]), std::abs(b_phi[j])) * max_modulus(stress.b)
+         + std::max(std::abs(c_phi[i]), std::abs(c_phi[j])) * max_modulus(stress.c) + max_modulus(stress.d);
+}
+
+AngleExtreme PlateAngleSearch::maximise(const RelocalisedStress& stress, AngleSearchMode mode) const {
+    if (angles.empty()) return AngleExtreme();
+    if (mode == AngleSearchMode::sweep) return sweep(stress);
+    return refine(stress);
+}
+
+AngleExtreme PlateAngleSearch::sweep(const RelocalisedStress& stress) const {
+    AngleExtreme extreme;
+    std::vector<double> values;
+    kernel.evaluate(stress, values);
+    for (std::size_t rank = 0; rank < values.size(); ++rank) {
+        if (rank == 0 || values[rank] > extreme.value) {
+            extreme.value = values[rank];
+            extreme.rank = rank;
+        }
+    }
+    extreme.nb_evaluations = kernel.nb_folded();
+    return extreme;
+}
+
+AngleExtreme PlateAngleSearch::refine(const RelocalisedStress& stress) const {
+    AngleExtreme extreme;
+    double eq_a = equivalent(stress.a);
+    double eq_b = equivalent(stress.b);
+    double eq_c = equivalent(stress.c);
+    double eq_d = equivalent(stress.d);
+    extreme.nb_evaluations = 4;
+
+    // upper bound of the equivalent stress on each piece (the coefficients are affine on a piece), increased by the
+    // errors of the computed equivalent stresses of the bound and of the angles of the piece
+    std::vector<double> bounds(pieces.size());
+    double error = equivalent_error();
+    for (std::size_t p = 0; p < pieces.size(); ++p) {
+        std::size_t i = pieces[p].first, j = pieces[p].last;
+        double bound = std::max(std::abs(a_phi[i]), std::abs(a_phi[j])) * eq_a
+                     + std::max(std::abs(b_phi[i]), std::abs(b_phi[j])) * eq_b
+                     + std::max(std::abs(c_phi[i]), std::abs(c_phi[j])) * eq_c + eq_d;
+        bounds[p] = bound * (1. + BOUND_MARGIN) + 2. * error * norm_bound(stress, p);
+    }
+    std::vector<std::size_t> order(pieces.size());
+    for (std::size_t p = 0; p < order.size(); ++p) order[p] = p;
+    std::stable_sort(order.begin(), order.end(), [&bounds](std::size_t p, std::size_t q) {
+        return bounds[p] > bounds[q];
+    });
+
+    // the first angle is kept for equal values
+    std::vector<bool> evaluated(angles.size(), false);
+    std::vector<double> values(angles.size(), 0.);
+    bool found = false;
+    auto evaluate = [&](std::size_t rank) {
+        if (evaluated[rank]) return values[rank];
+        evaluated[rank] = true;
+        double value = values[rank] = equivalent(stress, rank);
+        ++extreme.nb_evaluations;
+        if (!found || value > extreme.value || (value == extreme.value && rank < extreme.rank)) {
+            extreme.value = value;
+            extreme.rank = rank;
+            found = true;
+        }
+        return value;
+    };
+
+    // the maximum of the exact equivalent stress of a piece is reached on one of its ends
+    std::vector<std::size_t> candidates;
+    for (std::size_t p : order) {
+        if (found && bounds[p] < extreme.value) break;
+        evaluate(pieces[p].first);
+        evaluate(pieces[p].last);
+        candidates.push_back(p);
+    }
+
+    // the computed equivalent stress of an inner angle may exceed the ones of the ends by the rounding errors: the
+    // inner angles of a piece are evaluated if they can reach the current maximum, so that the maximum is the one of
+    // the dense sweep
+    for (std::size_t p : candidates) {
+        std::size_t i = pieces[p].first, j = pieces[p].last;
+        double ends = std::max(values[i], values[j]);
+        if (ends + 2. * error * norm_bound(stress, p) < extreme.value) continue;
+        for (std::size_t rank = i + 1; rank < j; ++rank) evaluate(rank);
+    }
+    return extreme;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "PlateStressKernel.h"
+
+namespace amath {
+
+    /// \brief Maximal equivalent stress over the angles of a plate analysis.
+    struct AngleExtreme {
+        /// \brief maximal equivalent stress
+        double value = 0.;
+        /// \brief rank of the (first) angle reaching the maximum
+        std::size_t rank = 0;
+        /// \brief number of equivalent stresses computed to find the maximum
+        std::size_t nb_evaluations = 0;
+    };
+
+    /// \brief Method used to find the maximal equivalent stress over the angles.
+    enum class AngleSearchMode {
+        /// \brief every angle is evaluated
+        sweep,
+        /// \brief only the angle intervals which can still hold the maximum are evaluated
+        refine
+    };
+
+    /// \brief Absolute error of the Tresca stress, relative to the largest component modulus of the tensor. The
+    /// principal stresses are computed with the Cardan method, whose error grows like \f$ \epsilon^{1/3} \f$ near
+    /// repeated eigenvalues (about \f$ 2 \times 10^{-5} \f$ measured on near-hydrostatic tensors).
+    static constexpr double TRESCA_STRESS_ERROR = 1e-4;
+    /// \brief Absolute error of the von Mises stresses, relative to the largest component modulus of the tensor.
+    static constexpr double MISES_STRESS_ERROR = 1e-12;
+
+    /// \brief Search of the maximal equivalent stress of a relocalised stress over the angles \f$ \phi \f$ of a
+    /// plate analysis.
+    ///
+    /// The relocalisation coefficients are piecewise-linear functions of \f$ \phi \f$. The analysis angles are
+    /// split in pieces: the angles of a piece are in the same interval of the coefficients (an angle equal to a knot
+    /// of the coefficients belongs to both adjacent pieces). On a piece, the relocalised stress is an affine function
+    /// of \f$ \phi \f$ and the equivalent stress (Tresca, von Mises or reduced von Mises) is a seminorm, so that the
+    /// equivalent stress is convex on the piece: its maximum is reached on the first or the last angle of the piece.
+    /// Moreover, it is bounded by \f$ \max|a_{\phi}| E(A) + \max|b_{\phi}| E(B) + \max|c_{\phi}| E(C) + E(D) \f$.
+    ///
+    /// In refine mode, the pieces are examined by decreasing bound and the search stops when the bound of the next
+    /// piece, increased by the rounding errors of the equivalent stresses of the piece, is lower than the current
+    /// maximum. The convexity holds for the exact equivalent stresses only: the computed stress of an inner angle may
+    /// exceed the ones of the ends of its piece by twice the error of the equivalent stress (TRESCA_STRESS_ERROR or
+    /// MISES_STRESS_ERROR times the largest component modulus of the relocalised stresses of the piece). The inner
+    /// angles of the examined pieces whose ends are within this margin of the maximum are therefore evaluated too,
+    /// so that the refined maximum and its angle rank are the ones of the dense sweep.
+    class PlateAngleSearch {
+        private:
+            /// \brief Consecutive analysis angles inside one interval of the coefficients
+            struct AnglePiece {
+                std::size_t first;
+                std::size_t last;
+            };
+
+            /// \brief analysis angles (sorted)
+            std::vector<double> angles;
+            /// \brief values of \f$ a_{\phi} \f$ for the analysis angles
+            std::vector<double> a_phi;
+            /// \brief values of \f$ b_{\phi} \f$ for the analysis angles
+            std::vector<double> b_phi;
+            /// \brief values of \f$ c_{\phi} \f$ for the analysis angles
+            std::vector<double> c_phi;
+            /// \brief pieces of the analysis angles, in increasing order
+            std::vector<AnglePiece> pieces;
+            /// \brief method used to compute the equivalent stress
+            std::string equivalent_stress_method = "tresca";
+            /// \brief kernel computing the stresses of all the analysis angles (sweep mode)
+            PlateStressKernel kernel;
+
+            /// \brief Return the equivalent stress of a stress tensor
+            double equivalent(const Stress& stress) const;
+            /// \brief Return the equivalent stress of the relocalised stress for an analysis angle
+            double equivalent(const RelocalisedStress& stress, std::size_t rank) const;
+            /// \brief Return the absolute error of the equivalent stress relative to the largest component modulus
+            double equivalent_error() const;
+            /// \brief Return a bound of the largest component modulus of the relocalised stresses of a piece
+            double norm_bound(const RelocalisedStress& stress, std::size_t piece) const;
+
+            AngleExtreme sweep(const RelocalisedStress& stress) const;
+            AngleExtreme refine(const RelocalisedStress& stress) const;
+
+        public:
+            /// \brief Constructor
+            /// \param knots sorted angles on which the relocalisation coefficients are defined
+            /// \param a values of \f$ a_{\phi} \f$ on the knots
+            /// \param b values of \f$ b_{\phi} \f$ on the knots
+            /// \param c values of \f$ c_{\phi} \f$ on the knots
+            /// \param grid sorted angles of the analysis, in the range of the knots
+            /// \param method equivalent stress method: "tresca", "mises" or "reduced_mises"
+            PlateAngleSearch(const std::vector<double>& knots, const std::vector<double>& a,
+                             const std::vector<double>& b, const std::vector<double>& c,
+                             const std::vector<double>& grid, const std::string& method = "tresca");
+
+            /// \brief Return the analysis angles
+            const std::vector<double>& get_angles() const { return angles; }
+            /// \brief Return the number of pieces of the analysis angles
+            std::size_t nb_pieces() const { return pieces.size(); }
+
+            /// \brief Return the maximal equivalent stress of a relocalised stress over the analysis angles
+            /// \param stress relocalised stress
+            /// \param mode search method
+            AngleExtreme maximise(const RelocalisedStress& stress, AngleSearchMode mode = AngleSearchMode::refine) const;
+    };
+}
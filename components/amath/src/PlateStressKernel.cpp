@@ -0,0 +1,96 @@
+#include <array>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+
+#include "PlateStressKernel.h"
+
+using namespace amath;
+
+Stress RelocalisedStress::at(double a_phi, double b_phi, double c_phi) const {
+    Stress s(d);
+    for (std::size_t i = 0; i < STRESS_SIZE; ++i) s[i] += a_phi * a[i] + b_phi * b[i] + c_phi * c[i];
+    return s;
+}
+
+PlateStressKernel::PlateStressKernel(const std::vector<double>& a, const std::vector<double>& b,
+                                     const std::vector<double>& c, const std::string& method) {
+    if (method != "tresca" && method != "mises" && method != "reduced_mises") {
+        throw std::invalid_argument("Invalid equivalent stress method");
+    }
+    equivalent_stress_method = method;
+    if (b.size() != a.size() || c.size() != a.size()) {
+        throw std::invalid_argument("Invalid relocalisation coefficients");
+    }
+
+    // group the angles by coefficients (a_phi, b_phi, |c_phi|)
+    std::map<std::array<double, 3>, std::size_t> groups;
+    folded_rank.reserve(a.size());
+    for (std::size_t k = 0; k < a.size(); ++k) {
+        std::array<double, 3> key = {a[k], b[k], std::abs(c[k])};
+        auto it = groups.emplace(key, groups.size()).first;
+        if (it->second == group_a.size()) {
+            group_a.push_back(key[0]);
+            group_b.push_back(key[1]);
+            group_c.push_back(key[2]);
+        }
+        // the sign bit is used so that c_phi = -0 gives the same signed zeros as RelocalisedStress::at
+        folded_rank.push_back(2 * it->second + (std::signbit(c[k]) ? 1 : 0));
+    }
+    folded_used.assign(2 * group_a.size(), false);
+    for (std::size_t rank : folded_rank) folded_used[rank] = true;
+}
+
+double PlateStressKernel::equivalent(const Stress& stress) const {
+    if (equivalent_stress_method == "mises") return stress.mises();
+    if (equivalent_stress_method == "reduced_mises") return stress.reduced_mises();
+    return stress.tresca();
+}
+
+std::size_t PlateStressKernel::nb_folded() const {
+    std::size_t count = 0;
+    for (bool used : folded_used) count += used ? 1 : 0;
+    return count;
+}
+
+void PlateStressKernel::fold(const RelocalisedStress& stress, std::vector<Stress>& folded) const {
+    folded.resize(folded_used.size());
+    for (std::size_t g = 0; g < group_a.size(); ++g) {
+        bool positive = folded_used[2 * g], negative = folded_used[2 * g + 1];
+        for (std::size_t i = 0; i < STRESS_SIZE; ++i) {
+            // products a_phi A + b_phi B and |c_phi| C are shared by the angles of the group, the stresses
+            // d + (a_phi A + b_phi B +/- |c_phi| C) are rounded as in RelocalisedStress::at
+            double ab = group_a[g] * stress.a[i] + group_b[g] * stress.b[i];
+            double c = group_c[g] * stress.c[i];
+            if (positive) folded[2 * g][i] = stress.d[i] + (ab + c);
+            if (negative) folded[2 * g + 1][i] = stress.d[i] + (ab - c);
+        }
+    }
+}
+
+void PlateStressKernel::relocalise(const RelocalisedStress& stress, std::vector<Stress>& tensors) const {
+    std::vector<Stress> folded;
+    fold(stress, folded);
+    tensors.clear();
+    tensors.reserve(folded_rank.size());
+    for (std::size_t rank : folded_rank) tensors.push_back(folded[rank]);
+}
+
+void PlateStressKernel::evaluate(const RelocalisedStress& stress, std::vector<double>& values) const {
+    evaluate(std::vector<RelocalisedStress>{stress}, values);
+}
+
+void PlateStressKernel::evaluate(const std::vector<RelocalisedStress>& stresses, std::vector<double>& values) const {
+    std::vector<Stress> folded;
+    std::vector<double> folded_values(folded_used.size());
+    values.resize(stresses.size() * folded_rank.size());
+
+    auto out = values.begin();
+    for (const auto& stress : stresses) {
+        fold(stress, folded);
+        for (std::size_t rank = 0; rank < folded_used.size(); ++rank) {
+            if (folded_used[rank]) folded_values[rank] = equivalent(folded[rank]);
+        }
+        for (std::size_t rank : folded_rank) *out++ = folded_values[rank];
+    }
+}
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+#include "PolynomialCurve.h"
+
+using namespace amath;
+
+PolynomialCurve::PolynomialCurve(const std::vector<double>& coefficients, double xmin, double xmax,
+                                 std::size_t knots_by_decade) : coefficients(coefficients) {
+    if (coefficients.empty()) throw std::invalid_argument("Polynomial without coefficients");
+    if (xmin <= 0. || xmax <= xmin || knots_by_decade == 0) throw std::invalid_argument("Invalid polynomial interval");
+
+    for (std::size_t i = 1; i < coefficients.size(); ++i) derivatives.push_back(static_cast<double>(i) * coefficients[i]);
+
+    // logarithmically spaced knots, the bounds of the interval included
+    double decades = std::log10(xmax / xmin);
+    std::size_t nb_intervals = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(decades * knots_by_decade)));
+    knots.resize(nb_intervals + 1);
+    for (std::size_t k = 0; k <= nb_intervals; ++k) {
+        knots[k] = xmin * std::pow(10., decades * static_cast<double>(k) / static_cast<double>(nb_intervals));
+    }
+    knots.front() = xmin;
+    knots.back() = xmax;
+
+    minima.resize(knots.size());
+    values(knots, minima);
+    for (std::size_t k = 1; k < minima.size(); ++k) minima[k] = std::min(minima[k], minima[k - 1]);
+}
+
+double PolynomialCurve::value(double x) const {
+    double y = 0.;
+    for (auto c = coefficients.rbegin(); c != coefficients.rend(); ++c) y = y * x + *c;
+    return y;
+}
+
+void PolynomialCurve::values(const std::vector<double>& x, std::vector<double>& y) const {
+    y.assign(x.size(), 0.);
+    for (auto c = coefficients.rbegin(); c != coefficients.rend(); ++c) {
+        for (std::size_t k = 0; k < x.size(); ++k) y[k] = y[k] * x[k] + *c;
+    }
+}
+
+double PolynomialCurve::inverse(double y) const {
+    if (knots.empty()) throw std::runtime_error("Polynomial curve is not defined");
+    if (std::isnan(y) || y < minima.back()) return std::numeric_limits<double>::quiet_NaN();
+    if (y >= minima.front()) return knots.front();
+
+    // first knot whose running minimum reaches the ordinate: the crossing lies in [knots[k-1], knots[k]]
+    auto it = std::lower_bound(minima.begin(), minima.end(), y, std::greater<double>());
+    std::size_t k = static_cast<std::size_t>(it - minima.begin());
+    double lower = knots[k - 1];
+    double upper = knots[k];
+
+    // safeguarded Newton steps on p(x) - y, with p(lower) > y and p(upper) <= y
+    double x = upper;
+    for (std::size_t it = 0; it < POLYNOMIAL_INVERSE_MAX_ITERATIONS; ++it) {
+        double g = value(x) - y;
+        if (g > 0.) lower = x; else upper = x;
+
+        double dg = 0.;
+        for (auto c = derivatives.rbegin(); c != derivatives.rend(); ++c) dg = dg * x + *c;
+        double next = x - g / dg;
+        if (!(next >= lower && next <= upper)) next = 0.5 * (lower + upper);
+        if (upper - lower <= POLYNOMIAL_INVERSE_TOLERANCE * upper) break;
+        bool converged = std::abs(next - x) <= POLYNOMIAL_INVERSE_TOLERANCE * next;
+        x = next;
+        if (converged) break;
+    }
+    return x;
+}
+
+void PolynomialCurve::inverse(const std::vector<double>& y, std::vector<double>& x) const {
+    x.resize(y.size());
+    for (std::size_t k = 0; k < y.size(); ++k) x[k] = inverse(y[k]);
+}
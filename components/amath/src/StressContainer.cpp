@@ -10,9 +10,20 @@ StressContainer::StressContainer(const StressContainer& other) {
     this->_mean_ = other._mean_;
     this->_loads_ = other._loads_;
     this->_torsor_ = other._torsor_;
+    this->_combination_ = other._combination_;
     this->_temperatures_ = other._temperatures_;
 }
 
+StressContainer::StressContainer(const StressRecord& record) {
+    this->_intensity_ = record.intensity;
+    this->_ratio_ = record.ratio;
+    this->_mean_ = record.mean;
+    this->_loads_ = {record.loads.first, record.loads.second};
+    this->_torsor_ = record.torsor;
+    this->_combination_ = record.combination;
+    this->_temperatures_ = {record.temperatures[0], record.temperatures[1]};
+}
+
 StressContainer& StressContainer::operator=(const StressContainer& other) {
     if (this != &other) {
         this->_intensity_ = other._intensity_;
@@ -20,6 +31,7 @@ StressContainer& StressContainer::operator=(const StressContainer& other) {
         this->_mean_ = other._mean_;
         this->_loads_ = other._loads_;
         this->_torsor_ = other._torsor_;
+        this->_combination_ = other._combination_;
         this->_temperatures_ = other._temperatures_;
     }
     return *this;
@@ -89,8 +101,28 @@ void StressContainer::set_temperatures(const double& T1, const double& T2) {
     _temperatures_.second = T2;
 }
 
-void StressContainer::store_max(const StressContainer& other) {
-    if (*this < other)  *this = other;
+bool StressContainer::is_exceeded_by(const StressContainer& other) const {
+    if (_ratio_ != other._ratio_) return _ratio_ < other._ratio_;
+    if (_combination_ != other._combination_) return other._combination_ < _combination_;
+    if (_torsor_ != other._torsor_) return other._torsor_ < _torsor_;
+    return other._loads_ < _loads_;
+}
+
+void StressContainer::store_max(const StressContainer& other, bool total_order) {
+    if (total_order ? is_exceeded_by(other) : *this < other) *this = other;
+}
+
+StressRecord StressContainer::compact() const {
+    StressRecord record;
+    record.intensity = static_cast<float>(_intensity_);
+    record.ratio = static_cast<float>(_ratio_);
+    record.mean = static_cast<float>(_mean_);
+    record.loads = {to_compact_rank(_loads_.first), to_compact_rank(_loads_.second)};
+    record.combination = to_compact_rank(_combination_);
+    record.torsor = to_compact_torsor(_torsor_);
+    record.temperatures[0] = static_cast<float>(_temperatures_.first);
+    record.temperatures[1] = static_cast<float>(_temperatures_.second);
+    return record;
 }
 
 StressIntensity StressContainer::get_intensity() const {
@@ -102,5 +134,6 @@ StressIntensity StressContainer::get_intensity() const {
 StressRange StressContainer::get_range() const {
     StressRange result;
     result.set(_intensity_, _mean_, _ratio_, _loads_, _torsor_);
+    result.combination = _combination_;
     return result;
 }
@@ -5,6 +5,7 @@
 
 #include "Combination.h"
 #include "Stress.h"
+#include "StressRecord.h"
 
 namespace amath {
 
@@ -37,6 +38,8 @@ namespace amath {
         combi_ranks loads = {0, 0};
         /// \brief The torsor combination rank associated with the stress range and the mean stress.
         std::size_t torsor = 0;
+        /// \brief The combination rank (in the explorer) associated with the stress range and the mean stress.
+        std::size_t combination = 0;
         /// \brief Temperatures associated to loads given the stress range
         std::pair<double, double> temperatures = {0., 0.};
 
@@ -65,6 +68,8 @@ namespace amath {
             combi_ranks _loads_ = {0, 0};
             /// \brief The torsor combination numbers associated with the stress range and the mean stress.
             std::size_t _torsor_ = 0;
+            /// \brief The combination rank (in the explorer) associated with the stress range and the mean stress.
+            std::size_t _combination_ = 0;
             /// \brief Temperatures associated to loads given the stress range
             std::pair<double, double> _temperatures_ = {0., 0.};
 
@@ -77,6 +82,9 @@ namespace amath {
             /// @brief constructor by copy
             /// @param other an other StressContainer object
             StressContainer(const StressContainer& other);
+            /// @brief constructor from a compact record (stresses and temperatures are widened from float values)
+            /// @param record a compact record
+            explicit StressContainer(const StressRecord& record);
             /// @brief Copy constructor 
             /// @param other an other StressContainer object
             StressContainer& operator=(const StressContainer& other);
@@ -96,6 +104,12 @@ namespace amath {
 
             /// @brief return the stored ratio
             double get_ratio() const { return _ratio_; }
+            /// @brief Total order used to select the maximum: the greatest ratio, then the lowest combination rank, 
+            /// then the lowest torsor combination rank and finally the lowest loads. The retained maximum is therefore
+            /// the one found first by a sequential exploration, whatever the order of the partial results.
+            /// @param other an other StressContainer object
+            /// @return true if `other` must replace this object as maximum
+            bool is_exceeded_by(const StressContainer& other) const;
 
             /// @brief Set a stress intensity
             /// @param intensity equivalent stress intensity
@@ -117,10 +131,20 @@ namespace amath {
             /// @brief Set the mean stress associated to the stress range
             /// @param mean value of mean stress
             void set_mean_stress(const double& mean) { _mean_ = mean; }
+            /// @brief Set the combination rank (in the explorer) associated to the stress range
+            /// @param combination combination rank
+            void set_combination(const std::size_t combination) { _combination_ = combination; }
 
             /// @brief Update internals parameters for maximal stress intensity
             /// @param other a stess range
-            void store_max(const StressContainer& other);
+            /// @param total_order if true, the maximum is selected with the total order of `is_exceeded_by` 
+            /// (deterministic mode), otherwise with the ratio only (the current maximum is kept for equal ratios)
+            void store_max(const StressContainer& other, bool total_order = false);
+
+            /// @brief Return the compact record associated to the stored results. An exception is raised if a rank does
+            /// not fit in the compact record.
+            /// @return compact record
+            StressRecord compact() const;
 
             /// @brief Return a structure with detailed results for stress intensity
             /// @return detailed stress intensity
@@ -130,4 +154,6 @@ namespace amath {
             StressRange get_range() const;
 
     };
+
+    static_assert(2 * sizeof(StressRecord) <= sizeof(StressContainer), "StressRecord must be half a StressContainer");
 }
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include <limits>
+#include <stdexcept>
+
+#include "StressRecord.h"
+
+using namespace amath;
+
+bool StressRecord::is_exceeded_by(const StressRecord& other) const {
+    if (ratio != other.ratio) return ratio < other.ratio;
+    if (combination != other.combination) return other.combination < combination;
+    if (torsor != other.torsor) return other.torsor < torsor;
+    return other.loads < loads;
+}
+
+std::uint32_t amath::to_compact_rank(std::size_t rank) {
+    if (rank > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::overflow_error("Rank too large for a compact record");
+    }
+    return static_cast<std::uint32_t>(rank);
+}
+
+std::uint16_t amath::to_compact_torsor(std::size_t torsor) {
+    if (torsor > std::numeric_limits<std::uint16_t>::max()) {
+        throw std::overflow_error("Torsor combination rank too large for a compact record");
+    }
+    return static_cast<std::uint16_t>(torsor);
+}
+
+void SparseRecordMatrix::store_max(std::size_t row, std::size_t column, const StressRecord& record, bool total_order) {
+    auto result = records.emplace(key(to_compact_rank(row), to_compact_rank(column)), record);
+    if (!result.second) result.first->second.store_max(record, total_order);
+}
+
+void SparseRecordMatrix::merge(const SparseRecordMatrix& other, bool total_order) {
+    for (const auto& [k, record] : other.records) {
+        auto result = records.emplace(k, record);
+        if (!result.second) result.first->second.store_max(record, total_order);
+    }
+}
+
+const StressRecord* SparseRecordMatrix::find(std::size_t row, std::size_t column) const {
+    if (row > std::numeric_limits<std::uint32_t>::max() || column > std::numeric_limits<std::uint32_t>::max()) {
+        return nullptr;
+    }
+    auto it = records.find(key(static_cast<std::uint32_t>(row), static_cast<std::uint32_t>(column)));
+    if (it == records.end()) return nullptr;
+    return &it->second;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+namespace amath {
+
+    /// @brief Compact pair of state ranks
+    using compact_ranks = std::pair<std::uint32_t, std::uint32_t>;
+
+    /// @brief Compact storage of a stress intensity or a stress range result, used for large result caches (pair
+    /// memos, per-thread partial results, sparse interaction matrices): half the size of \ref StressContainer.
+    /// State and combination ranks are stored on 32 bits, the torsor combination rank on 16 bits and the stresses
+    /// and temperatures as float values (about 7 significant digits). The maxima of records are therefore selected
+    /// on the rounded ratios: the wide representation (\ref StressContainer) must be used for reporting.
+    struct StressRecord {
+        /// \brief The stress range (or the stress intensity).
+        float intensity = 0.f;
+        /// \brief The maximum ratio between stress range and a coefficient.
+        float ratio = 0.f;
+        /// \brief The mean stress.
+        float mean = 0.f;
+        /// \brief The load numbers associated with the stress range.
+        compact_ranks loads = {0, 0};
+        /// \brief The combination rank (in the explorer) associated with the stress range.
+        std::uint32_t combination = 0;
+        /// \brief Temperatures associated to loads given the stress range.
+        float temperatures[2] = {0.f, 0.f};
+        /// \brief The torsor combination rank associated with the stress range.
+        std::uint16_t torsor = 0;
+
+        /// @brief Total order used to select the maximum (same order as `StressContainer::is_exceeded_by`)
+        /// @param other an other record
+        /// @return true if `other` must replace this record as maximum
+        bool is_exceeded_by(const StressRecord& other) const;
+        /// @brief Update the record with the maximum of both records (same selection as `StressContainer::store_max`)
+        /// @param other an other record
+        /// @param total_order if true, the maximum is selected with the total order of `is_exceeded_by`
+        /// (deterministic mode), otherwise with the ratio only (the current maximum is kept for equal ratios)
+        void store_max(const StressRecord& other, bool total_order = false) {
+            if (total_order ? is_exceeded_by(other) : ratio < other.ratio) *this = other;
+        }
+    };
+
+    static_assert(sizeof(StressRecord) <= 36, "StressRecord must stay compact");
+
+    /// @brief Convert a rank to a 32-bit rank, an exception is raised on overflow.
+    /// @param rank rank to convert
+    /// @return 32-bit rank
+    std::uint32_t to_compact_rank(std::size_t rank);
+    /// @brief Convert a torsor combination rank to a 16-bit rank, an exception is raised on overflow.
+    /// @param torsor torsor combination rank to convert
+    /// @return 16-bit rank
+    std::uint16_t to_compact_torsor(std::size_t torsor);
+
+    /// @brief Sparse matrix of compact records indexed by a pair of ranks (states, transients, ...). Only the
+    /// maximum record is kept for each pair.
+    class SparseRecordMatrix {
+        private:
+            /// @brief records indexed by the packed pair of ranks
+            std::unordered_map<std::uint64_t, StressRecord> records;
+
+            /// @brief Pack a pair of ranks into a single key
+            static std::uint64_t key(std::uint32_t row, std::uint32_t column) {
+                return (static_cast<std::uint64_t>(row) << 32) | column;
+            }
+
+        public:
+            SparseRecordMatrix() = default;
+
+            /// @brief Return the number of stored records
+            std::size_t size() const { return records.size(); }
+            /// @brief Remove all records
+            void clear() { records.clear(); }
+            /// @brief Reserve storage for a number of records
+            void reserve(std::size_t nb_records) { records.reserve(nb_records); }
+
+            /// @brief Store a record, keeping the maximum one for the pair of ranks
+            /// @param row row rank
+            /// @param column column rank
+            /// @param record record to store
+            /// @param total_order selection of the maximum (see `StressRecord::store_max`)
+            void store_max(std::size_t row, std::size_t column, const StressRecord& record, bool total_order = false);
+            /// @brief Merge an other matrix, keeping the maximum record for each pair of ranks
+            /// @param other an other matrix
+            /// @param total_order selection of the maximum (see `StressRecord::store_max`)
+            void merge(const SparseRecordMatrix& other, bool total_order = false);
+            /// @brief Return a pointer to the record of a pair of ranks (nullptr if undefined)
+            /// @param row row rank
+            /// @param column column rank
+            const StressRecord* find(std::size_t row, std::size_t column) const;
+    };
+
+}
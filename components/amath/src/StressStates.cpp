@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <numeric>
 
@@ -72,7 +74,7 @@ StressContainer StressStates::stress_intensity(const std::vector<size_t>& states
                 torsors_manager.get_coef(rk, t, coefs);
                 Stotal = std::inner_product(coefs.begin(), coefs.end(), Torsors.begin(), Stotal);            
             }
-            _maximum_equivalent_stress_(Sc_max, Stotal, 1., loads, t);
+            _maximum_equivalent_stress_(Sc_max, Stotal, 1., loads, t, i);
         }
     }
     return Sc_max;
@@ -83,6 +85,11 @@ StressContainer StressStates::stress_range(const Combination& explorer) {
 }
 
 StressContainer StressStates::stress_range_ratio(const Combination& explorer, const Coefficient& coefficient) {
+    return stress_range_ratio(explorer, coefficient, 0, explorer.size());
+}
+
+StressContainer StressStates::stress_range_ratio(const Combination& explorer, const Coefficient& coefficient,
+                                                 std::size_t first, std::size_t last) {
     StressContainer Sc_max;
     combi_ranks ranks;
     Stress Scumul, Stotal;
@@ -93,9 +100,13 @@ StressContainer StressStates::stress_range_ratio(const Combination& explorer, co
     
     set_active_torsors(active_torsors);
 
-    for (std::size_t i = 0; i < explorer.size(); ++i) {
+    // the coefficient is interpolated once for each state
+    std::vector<double> states_coefficients = get_states_coefficients(coefficient);
+
+    last = std::min(last, explorer.size());
+    for (std::size_t i = first; i < last; ++i) {
         explorer.ranks_by_ptr(i, ranks);
-        double cc = get_interpolated_coeffient(coefficient, ranks);
+        double cc = get_interpolated_coeffient(coefficient, states_coefficients, ranks);
         Scumul = PrimaryStresses[ranks.first] - PrimaryStresses[ranks.second];
 
         for (std::size_t t = 0; t < torsors_manager.nb_combinaisons(ranks); ++t) {
@@ -105,7 +116,7 @@ StressContainer StressStates::stress_range_ratio(const Combination& explorer, co
                 torsors_manager.get_diff_coef(ranks, t, coefs);
                 Stotal = std::inner_product(coefs.begin(), coefs.end(), Torsors.begin(), Stotal);
             }
-            _maximum_equivalent_stress_(Sc_max, Stotal, cc, ranks, t);
+            _maximum_equivalent_stress_(Sc_max, Stotal, cc, ranks, t, i);
         }
     }
 
@@ -145,7 +156,9 @@ void StressStates::_check_() {
     }
 }
 
-void StressStates::_maximum_equivalent_stress_(StressContainer& Sr_max, const Stress& Sr, const double coef, const combi_ranks& loads, const std::size_t torsor) {
+void StressStates::_maximum_equivalent_stress_(StressContainer& Sr_max, const Stress& Sr, const double coef, 
+                                               const combi_ranks& loads, const std::size_t torsor, 
+                                               const std::size_t combination) {
     double ratio_max = 0.;
     if (equivalent_stress_method == "tresca") {
         ratio_max = Sr.tresca() / coef;
@@ -163,6 +176,7 @@ void StressStates::_maximum_equivalent_stress_(StressContainer& Sr_max, const St
 
     if (ratio_max > Sr_max.get_ratio()) {
         Sr_max.set_range({ratio_max * coef, ratio_max}, loads, torsor);
+        Sr_max.set_combination(combination);
         Sr_max.set_temperatures(Temperatures[loads.first], Temperatures[loads.second]);
     }
 }
@@ -180,11 +194,22 @@ double StressStates::compute_mean_stress(const StressContainer& Sr_max) const {
     return (equivalent_stress_method == "mises") ? mean_stress.mises() : mean_stress.tresca();
 }
 
-double StressStates::get_interpolated_coeffient(const Coefficient& coefficient, const combi_ranks& ranks) const {
+std::vector<double> StressStates::get_states_coefficients(const Coefficient& coefficient) const {
+    std::vector<double> values;
+    if (!Temperatures.empty()) coefficient.get_yvalues(Temperatures, values);
+    return values;
+}
+
+double StressStates::get_interpolated_coeffient(const Coefficient& coefficient,
+                                                const std::vector<double>& states_coefficients,
+                                                const combi_ranks& ranks) const {
     // case for undefined temperatures
     if (Temperatures.empty()) return 1.;
 
-    double c1 = coefficient.get_yvalue(Temperatures[ranks.first]);
-    double c2 = coefficient.get_yvalue(Temperatures[ranks.second]);
+    // temperatures outside the coefficient table are interpolated again to report the error
+    double c1 = states_coefficients[ranks.first];
+    double c2 = states_coefficients[ranks.second];
+    if (std::isnan(c1)) c1 = coefficient.get_yvalue(Temperatures[ranks.first]);
+    if (std::isnan(c2)) c2 = coefficient.get_yvalue(Temperatures[ranks.second]);
     return std::max(c1, c2);
 }
\ No newline at end of file
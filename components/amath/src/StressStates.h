@@ -27,18 +27,28 @@ namespace amath {
             /// \param coef The coefficient used to compute the stress range ratio.
             /// \param loads The load numbers associated with the stress range.
             /// \param torsor The torsor combination rank associated with the stress range.
+            /// \param combination The combination rank (in the explorer) associated with the stress range.
             void _maximum_equivalent_stress_(StressContainer& Sr_max, const Stress& stress, const double coef, 
-                                             const combi_ranks& loads, const std::size_t torsor);
+                                             const combi_ranks& loads, const std::size_t torsor, 
+                                             const std::size_t combination);
             /// \brief Determine the mean stress associated to a stress range
             /// \param Sr_max The maximum stress range.
             /// \return mean stress
             double compute_mean_stress(const StressContainer& Sr_max) const;
+            /// @brief Return the interpolated coefficient for each state. Temperature of each state is used to
+            /// determine the interpolated value (NaN if the temperature is outside the coefficient table).
+            /// @param coefficient coefficient used for interpolation
+            /// @return interpolated coefficient of each state (empty for undefined temperatures)
+            std::vector<double> get_states_coefficients(const Coefficient& coefficient) const;
             /// @brief Return the maximum interpoletd coefficient for 2 states. Temperature of each state is used to
             /// determine the interpolated value
             /// @param coefficient coefficient used for interpolation
+            /// @param states_coefficients interpolated coefficient of each state
             /// @param ranks states ranks
             /// @return maximum interpoletd coefficient
-            double get_interpolated_coeffient(const Coefficient& coefficient, const combi_ranks& ranks) const;
+            double get_interpolated_coeffient(const Coefficient& coefficient,
+                                              const std::vector<double>& states_coefficients,
+                                              const combi_ranks& ranks) const;
             
         protected:
             /// \brief A vector of primary stress states. If secondary stresses are not provided, the primary stresses
@@ -124,6 +134,15 @@ namespace amath {
             /// \param explorer combinations' explorer
             /// \return The maximum stress range.
             StressContainer stress_range_ratio(const Combination& explorer, const Coefficient& coefficient);
+            /// \brief Calculate the maximum stress range on a sub-range of combinations. The partial results of 
+            /// several sub-ranges can be merged with `StressContainer::store_max` (in any order with the total order).
+            /// \param explorer combinations' explorer
+            /// \param coefficient coefficient used to compute the stress range ratio
+            /// \param first first combination of the sub-range
+            /// \param last last combination of the sub-range (excluded)
+            /// \return The maximum stress range on the sub-range.
+            StressContainer stress_range_ratio(const Combination& explorer, const Coefficient& coefficient,
+                                               std::size_t first, std::size_t last);
 
     };
 
@@ -54,6 +54,12 @@ namespace amath {
             /// \param[in] abciss The abciss values.
             /// \param[in] ordinates The ordinates values.
             Table(const std::vector<double>& abciss, const std::vector<double>& ordinates);
+            /// \brief Constructor for the Table class based on ranges of abciss values and ordinates values.
+            /// \param[in] abciss_first, abciss_last The range of abciss values.
+            /// \param[in] ordinates_first, ordinates_last The range of ordinates values.
+            template<typename Iterator>
+            Table(Iterator abciss_first, Iterator abciss_last, Iterator ordinates_first, Iterator ordinates_last)
+                : xvalues(abciss_first, abciss_last), yvalues(ordinates_first, ordinates_last) { _check_(); }
             /// \brief Copy Constructor for the Table class.
             /// \param[in] table The object copy from Table class.
             Table(const Table& table);
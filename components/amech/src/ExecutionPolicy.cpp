@@ -0,0 +1,105 @@
+#include "ExecutionPolicy.h"
+
+using namespace amech;
+
+namespace {
+    /// @brief translation keys of the loop levels
+    const std::array<std::string, 5> LEVEL_KEYS = {
+        "PARALLEL_LEVEL_SECTIONS", "PARALLEL_LEVEL_TRANSIENT_PAIRS", "PARALLEL_LEVEL_LOADSTEP_PAIRS",
+        "PARALLEL_LEVEL_TORSOR_COMBINATIONS", "PARALLEL_LEVEL_NONE"
+    };
+    /// @brief loop levels from the outermost to the innermost one
+    const std::array<ParallelLevel, 4> LEVELS = {
+        ParallelLevel::sections, ParallelLevel::transient_pairs, ParallelLevel::loadstep_pairs,
+        ParallelLevel::torsor_combinations
+    };
+}
+
+std::size_t Workload::size(ParallelLevel level) const {
+    switch (level) {
+        case ParallelLevel::sections: return nb_sections;
+        case ParallelLevel::transient_pairs: return nb_transient_pairs;
+        case ParallelLevel::loadstep_pairs: return nb_loadstep_pairs;
+        case ParallelLevel::torsor_combinations: return nb_torsor_combinations;
+        default: return 1;
+    }
+}
+
+ExecutionPlan ExecutionPolicy::choose(const Workload& workload, std::size_t nb_threads, bool nested) {
+    ExecutionPlan plan;
+    if (nb_threads < 2) return plan;
+
+    // outermost level with enough units to be balanced alone
+    for (const auto level : LEVELS) {
+        if (workload.size(level) >= UNITS_BY_THREAD * nb_threads) {
+            plan.outer = level;
+            plan.outer_threads = nb_threads;
+            return plan;
+        }
+    }
+
+    // largest level used when nested parallelism is forbidden
+    if (!nested) {
+        for (const auto level : LEVELS) {
+            if (workload.size(level) > workload.size(plan.outer)) plan.outer = level;
+        }
+        plan.outer_threads = std::min(nb_threads, std::max<std::size_t>(workload.size(plan.outer), 1));
+        return plan;
+    }
+
+    // outermost level with several units, threads are shared with the largest inner level
+    std::size_t outer_rk = 0;
+    while (outer_rk < LEVELS.size() - 1 && workload.size(LEVELS[outer_rk]) < 2) outer_rk++;
+    plan.outer = LEVELS[outer_rk];
+    plan.outer_threads = std::min(nb_threads, std::max<std::size_t>(workload.size(plan.outer), 1));
+
+    std::size_t inner_threads = nb_threads / plan.outer_threads;
+    if (inner_threads < 2) return plan;
+
+    for (std::size_t rk = outer_rk + 1; rk < LEVELS.size(); ++rk) {
+        if (workload.size(LEVELS[rk]) < 2) continue;
+        if (plan.inner == ParallelLevel::none || workload.size(LEVELS[rk]) > workload.size(plan.inner)) {
+            plan.inner = LEVELS[rk];
+        }
+    }
+    if (plan.inner != ParallelLevel::none) {
+        plan.inner_threads = std::min(inner_threads, workload.size(plan.inner));
+    }
+    return plan;
+}
+
+void ExecutionPolicy::init(const Workload& workload) {
+    bool nested = true;
+    if (abase::globalConfigParser.hasKey("--no_omp_nested")) {
+        nested = !get_parser_value<bool>("--no_omp_nested");
+    }
+    _plan_ = choose(workload, abase::requested_nb_threads(), nested);
+
+    abase::globalThreadPool.resize(_plan_.outer_threads);
+    inner_pools.clear();
+    if (_plan_.inner == ParallelLevel::none) return;
+    for (std::size_t i = 0; i < _plan_.outer_threads; ++i) {
+        inner_pools.push_back(std::make_unique<abase::ThreadPool>());
+        inner_pools.back()->resize(_plan_.inner_threads);
+    }
+}
+
+abase::ThreadPool& ExecutionPolicy::pool(ParallelLevel level) {
+    if (level == _plan_.outer) return abase::globalThreadPool;
+    if (level == _plan_.inner && inner_pools.size() > 0) {
+        return *inner_pools[abase::ThreadPool::worker_rank() % inner_pools.size()];
+    }
+    return serial_pool;
+}
+
+bool ExecutionPolicy::is_deterministic() {
+    if (!abase::globalConfigParser.hasKey("--deterministic")) return false;
+    return get_parser_value<bool>("--deterministic");
+}
+
+std::string ExecutionPolicy::description() const {
+    std::string outer = translate(LEVEL_KEYS[static_cast<std::size_t>(_plan_.outer)]);
+    std::string inner = translate(LEVEL_KEYS[static_cast<std::size_t>(_plan_.inner)]);
+    return translate("EXECUTION_PLAN", {std::to_string(_plan_.outer_threads), outer,
+                                        std::to_string(_plan_.inner_threads), inner});
+}
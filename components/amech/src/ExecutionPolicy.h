@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "Environment.h"
+#include "ThreadPool.h"
+
+namespace amech {
+
+    /// @brief Minimal number of work units by thread required to parallelise a level without nesting
+    static constexpr std::size_t UNITS_BY_THREAD = 4;
+
+    /// @brief Loop levels of the fatigue analysis, from the outermost to the innermost one
+    enum class ParallelLevel : std::size_t {
+        sections = 0,
+        transient_pairs = 1,
+        loadstep_pairs = 2,
+        torsor_combinations = 3,
+        none = 4
+    };
+
+    /// @brief Size of each loop level of the fatigue analysis
+    struct Workload {
+        /// @brief number of cross-sections
+        std::size_t nb_sections = 0;
+        /// @brief number of transient pairs
+        std::size_t nb_transient_pairs = 0;
+        /// @brief maximal number of load-step pairs for a transient pair
+        std::size_t nb_loadstep_pairs = 0;
+        /// @brief maximal number of torsor combinations for a load-step pair
+        std::size_t nb_torsor_combinations = 0;
+
+        /// @brief Return the number of work units of a level
+        std::size_t size(ParallelLevel level) const;
+    };
+
+    /// @brief Parallel plan: the outer level is computed on the global thread pool, the inner level (if any) on a
+    /// dedicated pool for each outer thread. The total number of active threads never exceeds the requested one.
+    struct ExecutionPlan {
+        /// @brief outer parallel level
+        ParallelLevel outer = ParallelLevel::sections;
+        /// @brief number of threads used for the outer level
+        std::size_t outer_threads = 1;
+        /// @brief inner parallel level
+        ParallelLevel inner = ParallelLevel::none;
+        /// @brief number of threads used for the inner level (by outer thread)
+        std::size_t inner_threads = 1;
+    };
+
+    /// @brief Class used to choose, for a workload, the loop levels computed in parallel.
+    /// @details The outermost level with at least `UNITS_BY_THREAD` units by thread is parallelised alone. If no
+    /// level is large enough and nested parallelism is allowed (no `--no_omp_nested` option), the threads are shared
+    /// between the outermost level with several units and the largest inner level. Otherwise, the largest level is
+    /// parallelised alone.
+    class ExecutionPolicy {
+        private:
+            /// @brief current plan
+            ExecutionPlan _plan_;
+            /// @brief inner pools (one by outer thread)
+            std::vector<std::unique_ptr<abase::ThreadPool>> inner_pools;
+            /// @brief pool without worker used for sequential levels
+            abase::ThreadPool serial_pool;
+
+        public:
+            ExecutionPolicy() = default;
+            virtual ~ExecutionPolicy() = default;
+
+            /// @brief Choose the parallel plan for a workload
+            /// @param workload size of each loop level
+            /// @param nb_threads number of available threads
+            /// @param nested true if nested parallelism is allowed
+            /// @return the parallel plan
+            static ExecutionPlan choose(const Workload& workload, std::size_t nb_threads, bool nested);
+
+            /// @brief Choose the parallel plan and set up the thread pools accordingly
+            /// @param workload size of each loop level
+            void init(const Workload& workload);
+            /// @brief Return the current plan
+            const ExecutionPlan& plan() const { return _plan_; }
+            /// @brief Return the pool that must be used to compute a loop level. The pool of a sequential level
+            /// executes the tasks in the calling thread.
+            /// @param level loop level
+            /// @return reference to the thread pool
+            abase::ThreadPool& pool(ParallelLevel level);
+
+            /// @brief Return true if the deterministic mode is requested (`--deterministic` option). In this mode, the
+            /// tasks do not depend on the number of threads and partial results are merged in the task order.
+            static bool is_deterministic();
+
+            /// @brief Return a translated description of the plan for the resume file
+            std::string description() const;
+    };
+
+}
@@ -1,5 +1,13 @@
+#include <exception>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "CommandsGrammar.h"
 #include "GlobalTimer.h"
 #include "MechanicalProblem.h"
+#include "TaskGraph.h"
+#include "TransientCombination.h"
 
 using namespace amech;
 
@@ -8,6 +16,12 @@ void MechanicalProblem::init_output_resume() {
     output_resume.init(input_file); 
 }
 
+void MechanicalProblem::load_input_grammar() {
+    std::string app_path = get_parser_value<std::string>("application_path");
+    std::string input_commands = app_path + "/" +  get_parser_value<std::string>("input_commands");
+    abase::CommandsGrammar::load(input_commands);
+}
+
 void MechanicalProblem::read_input_data() {
     std::string app_path = get_parser_value<std::string>("application_path");
     std::string input_file = get_parser_value<std::string>("input_file");
@@ -17,19 +31,98 @@ void MechanicalProblem::read_input_data() {
     output_resume.write(msg);
 
     input_data = std::make_shared<adata::DataManager>();
-    input_data->read_data(input_file, input_commands);
+    if (abase::globalConfigParser.hasKey("--pipeline") && get_parser_value<bool>("--pipeline")) {
+        read_input_data_pipeline(input_file, input_commands);
+    } else {
+        input_data->read_data(input_file, input_commands);
+    }
     input_data->verify();
 }
 
+void MechanicalProblem::read_input_data_pipeline(const std::string& input_file, const std::string& input_commands) {
+    abase::ErrorManager& manager = abase::ErrorManager::getInstance();
+    adata::StreamedDataQueue queue(PIPELINE_CAPACITY);
+    input_data->set_pipeline(&queue);
+
+    // the input file is read by a separate thread which publishes the verified loadsteps and sections. The messages
+    // of both threads are deferred (an error raises an exception instead of terminating the program while the other
+    // thread is running) and reported once the reader is joined.
+    std::vector<abase::DeferredMessage> read_messages, analysis_messages;
+    std::exception_ptr read_error = nullptr;
+    std::thread reader([&]() {
+        manager.setDeferredBuffer(&read_messages);
+        try {
+            input_data->read_data(input_file, input_commands);
+        } catch (const abase::DeferredError&) {
+        } catch (...) {
+            read_error = std::current_exception();
+        }
+        manager.setDeferredBuffer(nullptr);
+        queue.close();
+    });
+
+    std::exception_ptr analysis_error = nullptr;
+    manager.setDeferredBuffer(&analysis_messages);
+    try {
+        adata::StreamedData data;
+        while (queue.pop(data)) analyse_streamed_data(data);
+    } catch (const abase::DeferredError&) {
+    } catch (...) {
+        analysis_error = std::current_exception();
+    }
+    manager.setDeferredBuffer(nullptr);
+    // stop the publication if the analysis has failed (the reader stops after the current command)
+    queue.close();
+
+    reader.join();
+    input_data->set_pipeline(nullptr);
+    manager.logDeferred(read_messages);
+    if (read_error) std::rethrow_exception(read_error);
+    manager.logDeferred(analysis_messages);
+    if (analysis_error) std::rethrow_exception(analysis_error);
+}
+
+void MechanicalProblem::analyse_streamed_data(const adata::StreamedData& data) {
+    if (data.loadstep == nullptr) return;
+    if (loadstep_masks.size() <= data.rank) loadstep_masks.resize(data.rank + 1);
+    loadstep_masks[data.rank] = TransientCombination::varying_mask(*data.loadstep, data.loadstep->get_nb_torsors());
+}
+
 void MechanicalProblem::set_physical_data() {
     physical_data = std::make_shared<adata::Collections>();
 }
 
+void MechanicalProblem::set_execution_policy() {
+    TransientCombination combination(input_data, loadstep_masks);
+    Workload workload;
+    workload.nb_sections = input_data->nb_sections();
+
+    std::size_t nb_tr = input_data->nb_transients();
+    workload.nb_transient_pairs = nb_tr * (nb_tr + 1) / 2;
+    for (std::size_t trk1 = 0; trk1 < nb_tr; ++trk1) {
+        for (std::size_t trk2 = trk1; trk2 < nb_tr; ++trk2) {
+            std::size_t nb_comb = combination.nb_pair_combinations(trk1, trk2);
+            // 2^t torsor combinations, saturated for the number of bits of std::size_t
+            std::size_t nb_varying = combination.nb_varying_torsors(trk1, trk2);
+            std::size_t nb_torsor_comb = nb_varying < std::numeric_limits<std::size_t>::digits ?
+                                         std::size_t(1) << nb_varying : std::numeric_limits<std::size_t>::max();
+            workload.nb_loadstep_pairs = std::max(workload.nb_loadstep_pairs, nb_comb);
+            workload.nb_torsor_combinations = std::max(workload.nb_torsor_combinations, nb_torsor_comb);
+        }
+    }
+
+    execution_policy.init(workload);
+    output_resume.write(execution_policy.description());
+}
+
 void MechanicalProblem::init() {
-    // Initialize the output resume file and folder
-    init_output_resume();
+    // Initialize the output resume file and folder while the commands tree of the input file is loaded
+    abase::TaskGraph startup;
+    startup.add("init_output_resume", [this]() { init_output_resume(); });
+    startup.add("load_input_grammar", [this]() { load_input_grammar(); });
+    startup.run();
 
-    // Read the physical data from the ressources files
+    // Set the physical data (each collection is read when it is first used)
     set_physical_data();
 
     // Read the user input data
@@ -37,6 +130,9 @@ void MechanicalProblem::init() {
     read_input_data();
     stop_timer("read_input_data");
 
+    // Choose the parallel levels according to the problem size
+    set_execution_policy();
+
     // Create Mechanical objects: transient, section, ...
     const adata::ProblemTransient transient = input_data->get_transient(0);
     std::cout << "Transient name: " << transient.name << std::endl;
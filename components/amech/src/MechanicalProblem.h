@@ -1,20 +1,36 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "Collections.h"
 #include "DataManager.h"
 #include "Environment.h"
+#include "ExecutionPolicy.h"
 #include "OutputResume.h"
 
 namespace amech {
 
+    /// @brief Maximal number of verified loadsteps and sections waiting for their analysis in pipeline mode
+    static constexpr std::size_t PIPELINE_CAPACITY = 64;
+
     class MechanicalProblem {
         private :
             /// @brief Set output resume file and folder.
             void init_output_resume();
+            /// @brief Load the commands tree definition of the user input file (kept by the process for the reading)
+            void load_input_grammar();
             /// @brief Set the physical data collection.
             void set_physical_data();
             /// @brief Read the user input data.
             void read_input_data();
+            /// @brief Read the user input data in a separate thread and analyse each loadstep and each section as soon
+            /// as it is verified (`--pipeline` option).
+            /// @param input_file user input file
+            /// @param input_commands file containing the commands tree definition
+            void read_input_data_pipeline(const std::string& input_file, const std::string& input_commands);
+            /// @brief Choose the parallel levels of the analysis and write the plan in the resume file.
+            void set_execution_policy();
 
         protected :
             /// @brief Collection of physical data readed from ressources files.
@@ -28,6 +44,18 @@ namespace amech {
 
             /// @brief Output resume file and folder.
             OutputResume output_resume;
+            /// @brief Parallel plan of the analysis.
+            ExecutionPolicy execution_policy;
+
+            /// @brief Varying torsors of each loadstep computed in pipeline mode (see
+            /// `TransientCombination::varying_mask`), by loadstep rank.
+            std::vector<std::vector<std::uint64_t>> loadstep_masks;
+
+            /// @brief Analysis of a verified loadstep or section published while the input file is still read
+            /// (pipeline mode). The other input data are not available yet: only the published object can be used.
+            /// By default, the varying torsors of each loadstep are computed (used by `set_execution_policy`).
+            /// @param data published loadstep or section
+            virtual void analyse_streamed_data(const adata::StreamedData& data);
 
         public :
             MechanicalProblem() = default;
@@ -1,24 +1,76 @@
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+
+#include "ExecutionPolicy.h"
+#include "Reduction.h"
+#include "TorsorCombination.h"
 #include "TransientCombination.h"
 
 using namespace amech;
 
+TransientCombination::TransientCombination(std::shared_ptr<adata::DataManager> input_data,
+                                           const std::vector<std::vector<std::uint64_t>>& loadstep_masks) 
+    : input_data(input_data) {
+    set_varying_masks(loadstep_masks);
+}
+
+std::vector<std::uint64_t> TransientCombination::varying_mask(const adata::ProblemLoadstep& loadstep,
+                                                              std::size_t nb_torsors) {
+    std::vector<std::uint64_t> mask((nb_torsors + 63) / 64, 0);
+    auto check_coefficients = [&](const std::vector<double>& cmax, const std::vector<double>& cmin) {
+        if (cmax.size() != nb_torsors || cmin.size() != nb_torsors) return;
+        for (std::size_t i = 0; i < nb_torsors; ++i) {
+            if (std::abs(std::abs(cmax[i]) - std::abs(cmin[i])) >= amath::COEFFICIENT_TOLERANCE) {
+                mask[i / 64] |= std::uint64_t(1) << (i % 64);
+            }
+        }
+    };
+    check_coefficients(loadstep.max_ef, loadstep.min_ef);
+    check_coefficients(loadstep.max_ft, loadstep.min_ft);
+    return mask;
+}
+
+void TransientCombination::set_varying_masks(const std::vector<std::vector<std::uint64_t>>& loadstep_masks) {
+    std::size_t nb_torsors = input_data->nb_torsors();
+    std::size_t nb_words = (nb_torsors + 63) / 64;
+    varying_masks.assign(input_data->nb_transients(), std::vector<std::uint64_t>(nb_words, 0));
+
+    // varying torsors of each loadstep (a precomputed mask is used only if it has the same number of torsors)
+    std::vector<std::vector<std::uint64_t>> masks(input_data->nb_loadsteps());
+    for (std::size_t rk = 0; rk < masks.size(); ++rk) {
+        const auto& loadstep = input_data->get_loadstep(rk);
+        bool computed = rk < loadstep_masks.size() && loadstep_masks[rk].size() == nb_words && 
+                        loadstep.get_nb_torsors() == nb_torsors;
+        masks[rk] = computed ? loadstep_masks[rk] : varying_mask(loadstep, nb_torsors);
+    }
+
+    for (std::size_t trk = 0; trk < varying_masks.size(); ++trk) {
+        auto& mask = varying_masks[trk];
+        // the loadstep ranks of a verified transient are lower than the number of loadsteps
+        for (const auto& rk : input_data->get_transient(trk).loadsteps) {
+            for (std::size_t w = 0; w < nb_words; ++w) mask[w] |= masks[rk][w];
+        }
+    }
+}
+
 amath::TriangularCombination TransientCombination::transient_combination(std::size_t trk) const {
-    std::vector<std::size_t> ranks = input_data->get_transient(trk).loadsteps;
-    amath::TriangularCombination explorer = amath::TriangularCombination(ranks);
+    const auto& ranks = input_data->get_transient(trk).loadsteps;
+    amath::TriangularCombination explorer = amath::TriangularCombination(ranks.nb_distinct());
     explorer.set_type(false);
     return explorer;
 }
 
 amath::RectangularCombination   TransientCombination::crossed_combination(std::size_t trk1, std::size_t trk2) const {
-    std::vector<std::size_t> ranks_1 = input_data->get_transient(trk1).loadsteps;
-    std::vector<std::size_t> ranks_2 = input_data->get_transient(trk2).loadsteps;
-    return amath::RectangularCombination(ranks_1, ranks_2);
+    const auto& ranks_1 = input_data->get_transient(trk1).loadsteps;
+    const auto& ranks_2 = input_data->get_transient(trk2).loadsteps;
+    return amath::RectangularCombination(ranks_1.size(), ranks_2.size());
 }
 
-amath::RectangularCombination TransientCombination::fictive_combination(std::size_t trk, std::size_t pivot_rank) const {
-    std::vector<std::size_t> ranks_1 = input_data->get_transient(trk).loadsteps;
-    std::vector<std::size_t> ranks_2 = {pivot_rank};
-    return amath::RectangularCombination(ranks_1, ranks_2);
+amath::RectangularCombination TransientCombination::fictive_combination(std::size_t trk, std::size_t) const {
+    // the pivot is the single rank of the second vector
+    const auto& ranks_1 = input_data->get_transient(trk).loadsteps;
+    return amath::RectangularCombination(ranks_1.size(), 1);
 }
 
 std::vector<std::string> TransientCombination::common_groups(const std::vector<std::size_t>& transient_ranks) const {
@@ -84,4 +136,113 @@ bool TransientCombination::is_shared_group(const std::vector<std::size_t>& trans
     }
 
     return true;
-}
\ No newline at end of file
+}
+
+std::size_t TransientCombination::nb_varying_torsors(std::size_t trk1, std::size_t trk2) const {
+    const auto& mask_1 = varying_masks.at(trk1);
+    const auto& mask_2 = varying_masks.at(trk2);
+    std::size_t nb_varying = 0;
+    for (std::size_t w = 0; w < mask_1.size(); ++w) nb_varying += std::bitset<64>(mask_1[w] | mask_2[w]).count();
+    return nb_varying;
+}
+
+std::size_t TransientCombination::nb_pair_combinations(std::size_t trk1, std::size_t trk2) const {
+    if (trk1 == trk2) return transient_combination(trk1).size();
+    return crossed_combination(trk1, trk2).size();
+}
+
+double TransientCombination::pair_cost(std::size_t trk1, std::size_t trk2) const {
+    double nb_combinations = static_cast<double>(nb_pair_combinations(trk1, trk2));
+    return nb_combinations * std::ldexp(1., nb_varying_torsors(trk1, trk2));
+}
+
+std::vector<TransientPairTask> TransientCombination::schedule_pairs(std::size_t nb_threads) const {
+    std::vector<TransientPairTask> pairs;
+    double total_cost = 0.;
+
+    // one task by transient pair
+    std::size_t nb_tr = input_data->nb_transients();
+    for (std::size_t trk1 = 0; trk1 < nb_tr; ++trk1) {
+        for (std::size_t trk2 = trk1; trk2 < nb_tr; ++trk2) {
+            std::size_t nb_comb = nb_pair_combinations(trk1, trk2);
+            if (nb_comb == 0) continue;
+            double cost = pair_cost(trk1, trk2);
+            pairs.push_back({0, trk1, trk2, 0, nb_comb, cost});
+            total_cost += cost;
+        }
+    }
+
+    // split the pairs with a cost greater than the target granularity
+    std::vector<TransientPairTask> tasks;
+    if (ExecutionPolicy::is_deterministic()) nb_threads = DETERMINISTIC_NB_THREADS;
+    double granularity = total_cost / static_cast<double>(std::max<std::size_t>(nb_threads, 1) * TASKS_BY_THREAD);
+    for (const auto& pair : pairs) {
+        std::size_t nb_comb = pair.last - pair.first;
+        std::size_t nb_parts = (nb_threads > 1 && pair.cost > granularity) ? 
+                               static_cast<std::size_t>(std::ceil(pair.cost / granularity)) : 1;
+        nb_parts = std::min(nb_parts, nb_comb);
+
+        for (std::size_t p = 0; p < nb_parts; ++p) {
+            std::size_t first = pair.first + (nb_comb * p) / nb_parts;
+            std::size_t last = pair.first + (nb_comb * (p + 1)) / nb_parts;
+            double cost = pair.cost * static_cast<double>(last - first) / static_cast<double>(nb_comb);
+            tasks.push_back({tasks.size(), pair.trk1, pair.trk2, first, last, cost});
+        }
+    }
+
+    // longest processing time first (stable order for equal costs)
+    std::stable_sort(tasks.begin(), tasks.end(), [](const TransientPairTask& a, const TransientPairTask& b) {
+        return a.cost > b.cost;
+    });
+    return tasks;
+}
+
+void TransientCombination::dispatch_pairs(const std::function<void(const TransientPairTask&)>& compute, 
+                                          abase::ThreadPool& pool) const {
+    std::vector<TransientPairTask> tasks = schedule_pairs(pool.size());
+
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        jobs.push_back([&compute, task]() { compute(task); });
+    }
+    pool.run(jobs);
+}
+
+amath::SparseRecordMatrix TransientCombination::pair_maxima(
+        const std::function<amath::StressRecord(const TransientPairTask&)>& compute, abase::ThreadPool& pool) const {
+    std::vector<TransientPairTask> tasks = schedule_pairs(pool.size());
+
+    amath::OrderedReduction<amath::StressRecord> partials(tasks.size());
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        jobs.push_back([&compute, &partials, task]() { partials[task.rank] = compute(task); });
+    }
+    pool.run(jobs);
+
+    std::vector<const TransientPairTask*> ranked_tasks(tasks.size());
+    for (const auto& task : tasks) ranked_tasks[task.rank] = &task;
+
+    bool total_order = ExecutionPolicy::is_deterministic();
+    amath::SparseRecordMatrix maxima;
+    for (std::size_t rank = 0; rank < partials.size(); ++rank) {
+        maxima.store_max(ranked_tasks[rank]->trk1, ranked_tasks[rank]->trk2, partials[rank], total_order);
+    }
+    return maxima;
+}
+
+double TransientCombination::pair_sum(const std::function<double(const TransientPairTask&)>& compute, 
+                                      abase::ThreadPool& pool) const {
+    std::vector<TransientPairTask> tasks = schedule_pairs(pool.size());
+
+    amath::OrderedReduction<double> partials(tasks.size(), 0.);
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        jobs.push_back([&compute, &partials, task]() { partials[task.rank] = compute(task); });
+    }
+    pool.run(jobs);
+
+    return amath::ordered_sum(partials.values());
+}
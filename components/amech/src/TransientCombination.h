@@ -1,13 +1,50 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
+
 #include "Combination.h"
 #include "DataManager.h"
 #include "Environment.h"
+#include "StressRecord.h"
+#include "ThreadPool.h"
 
 namespace amech {
 
+    /// @brief Number of tasks expected by thread when transient pairs are dispatched. Pairs with a cost greater
+    /// than the total cost divided by this number of tasks (and by the number of threads) are split.
+    static constexpr std::size_t TASKS_BY_THREAD = 8;
+    /// @brief Number of threads used to split the transient pairs in deterministic mode, so that the tasks (and the
+    /// order of the partial results) do not depend on the real number of threads.
+    static constexpr std::size_t DETERMINISTIC_NB_THREADS = 64;
+
+    /// @brief Task associated to a transient pair: a contiguous range of the load-step combinations given by 
+    /// `transient_combination` (same transient) or `crossed_combination` (two transients).
+    struct TransientPairTask {
+        /// @brief task rank in the natural order (transient pairs, then combinations), used to merge partial results
+        std::size_t rank = 0;
+        /// @brief rank of the first transient
+        std::size_t trk1 = 0;
+        /// @brief rank of the second transient
+        std::size_t trk2 = 0;
+        /// @brief first combination of the range
+        std::size_t first = 0;
+        /// @brief last combination of the range (excluded)
+        std::size_t last = 0;
+        /// @brief estimated cost of the task
+        double cost = 0.;
+    };
+
     class TransientCombination {
         private :
+            /// @brief Varying torsors of each transient: one bit by torsor, set if the maximal and minimal
+            /// coefficients differ for at least one time step of the transient.
+            std::vector<std::vector<std::uint64_t>> varying_masks;
+
+            /// @brief Compute the varying torsors of each transient.
+            /// @param loadstep_masks varying torsors of the loadsteps already computed (see `varying_mask`), by
+            /// loadstep rank. The masks of the other loadsteps are computed.
+            void set_varying_masks(const std::vector<std::vector<std::uint64_t>>& loadstep_masks);
 
         protected :
             /// @brief Input data readed from the user input files.
@@ -17,11 +54,21 @@ namespace amech {
             /// @brief Constructor by default.
             TransientCombination() = default;
             /// @brief Constructor with input data.
-            /// @param input_data Input data readed from the user input files.
-            TransientCombination(std::shared_ptr<adata::DataManager> input_data) : input_data(input_data) {};
+            /// @param input_data Input data readed from the user input files (all the transients must be read).
+            /// @param loadstep_masks varying torsors of the loadsteps already computed (see `varying_mask`), by
+            /// loadstep rank (for instance while the input file is read in pipeline mode).
+            TransientCombination(std::shared_ptr<adata::DataManager> input_data,
+                                 const std::vector<std::vector<std::uint64_t>>& loadstep_masks = {});
             /// @brief Destructor.
             virtual ~TransientCombination() = default;
 
+            /// @brief Return the varying torsors of a loadstep: one bit by torsor, set if the maximal and minimal
+            /// coefficients of the torsor differ (case with or without earthquake).
+            /// @param loadstep verified loadstep
+            /// @param nb_torsors number of external torsors
+            /// @return varying torsors (64 torsors by word)
+            static std::vector<std::uint64_t> varying_mask(const adata::ProblemLoadstep& loadstep, std::size_t nb_torsors);
+
             /// @brief Create a combination generator (upper triangular form) for all transient's time steps.
             /// @param trk transient rank
             /// @return combination generator
@@ -54,6 +101,55 @@ namespace amech {
             /// @return true if all transients are in the same shared group
             bool is_shared_group(const std::vector<std::size_t>& transient_ranks) const;
 
+            /// @brief Return the number of torsors with different maximal and minimal coefficients for at least one
+            /// time step of two transients (union of the masks of the transients computed by the constructor).
+            /// @param trk1 rank of the first transient
+            /// @param trk2 rank of the second transient
+            /// @return number of varying torsors
+            std::size_t nb_varying_torsors(std::size_t trk1, std::size_t trk2) const;
+            /// @brief Return the number of time steps combinations for two transients (see `transient_combination` 
+            /// and `crossed_combination`).
+            /// @param trk1 rank of the first transient
+            /// @param trk2 rank of the second transient
+            /// @return number of combinations
+            std::size_t nb_pair_combinations(std::size_t trk1, std::size_t trk2) const;
+            /// @brief Return the estimated cost of a transient pair given by:
+            /// \f$ |loadsteps(trk1)| \times |loadsteps(trk2)| \times 2^t \f$ with \f$ t \f$ the number of
+            /// varying torsors.
+            /// @param trk1 rank of the first transient
+            /// @param trk2 rank of the second transient
+            /// @return estimated cost
+            double pair_cost(std::size_t trk1, std::size_t trk2) const;
+
+            /// @brief Create the tasks associated to all transient pairs sorted by decreasing cost (longest 
+            /// processing time first). A pair whose cost exceeds the target granularity is split into sub-ranges of
+            /// combinations. In deterministic mode, the split does not depend on the number of threads.
+            /// @param nb_threads number of threads used to compute the tasks
+            /// @return sorted list of tasks
+            std::vector<TransientPairTask> schedule_pairs(std::size_t nb_threads) const;
+            /// @brief Compute all transient pairs on a thread pool, largest tasks first. Partial results must be stored
+            /// by task rank (see `amath::OrderedReduction`) to be merged independently of the thread timing.
+            /// @param compute function applied on each task
+            /// @param pool thread pool used for the computation
+            void dispatch_pairs(const std::function<void(const TransientPairTask&)>& compute, 
+                                abase::ThreadPool& pool = abase::globalThreadPool) const;
+            /// @brief Compute the maximum result of each transient pair on a thread pool (see `dispatch_pairs`). The
+            /// maximum of each task is kept as a compact record by task rank, then the records are merged in the task
+            /// order (total order of the records in deterministic mode).
+            /// @param compute function returning the maximum record of a task
+            /// @param pool thread pool used for the computation
+            /// @return maximum record of each transient pair (row `trk1`, column `trk2`)
+            amath::SparseRecordMatrix pair_maxima(const std::function<amath::StressRecord(const TransientPairTask&)>& compute,
+                                                  abase::ThreadPool& pool = abase::globalThreadPool) const;
+            /// @brief Compute the sum of a result over all transient pairs on a thread pool (for instance a
+            /// cumulative usage). The partial sum of each task is kept by task rank, then the partial sums are added
+            /// in the task order (see `amath::ordered_sum`).
+            /// @param compute function returning the partial sum of a task
+            /// @param pool thread pool used for the computation
+            /// @return sum over all the transient pairs
+            double pair_sum(const std::function<double(const TransientPairTask&)>& compute,
+                            abase::ThreadPool& pool = abase::globalThreadPool) const;
+
     };
     
 }
\ No newline at end of file
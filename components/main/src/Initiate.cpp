@@ -1,24 +1,57 @@
+#include <filesystem>
+
 #include "ArgumentParser.h"
 #include "GlobalTimer.h"
 #include "Filesystem.h"
+#include "TaskGraph.h"
 
 #include "Initiate.h"
 
 constexpr std::string_view CONFIG_FILE = "/etc/alliance.conf";
 constexpr std::string_view RESSOURCES_DIR = "/ressources";
+constexpr std::string_view TRANSLATIONS_EXTENSION = ".yml";
+
+/// @brief Load the configuration file and the translations files concurrently. Each translations file is read in
+/// its own manager, the managers are merged in the global one once all the files are read.
+/// @param app_path path of the application
+void load_configuration_and_translations(const std::string& app_path) {
+    std::string directory = app_path + std::string(RESSOURCES_DIR);
+    std::vector<std::string> files;
+    if (std::filesystem::is_directory(directory)) {
+        files = abase::getFilesbyExtension(directory, std::string(TRANSLATIONS_EXTENSION));
+    }
+    std::vector<abase::TranslationManager> translations(files.size());
+
+    abase::TaskGraph startup;
+    startup.add("load_configuration", [&app_path]() {
+        abase::globalConfigParser.loadFromFile(app_path + std::string(CONFIG_FILE));
+    });
+
+    // a missing directory is reported after the configuration errors, as by a sequential loading
+    if (!std::filesystem::is_directory(directory)) {
+        startup.add("load_translations", [&directory]() {
+            abase::globalTranslationManager.loadAllTranslations(directory);
+        });
+    }
 
-/// @brief Load the configuration file
-void load_configuration() {
-    std::string app_path = get_parser_value<std::string>("application_path");
-    abase::globalConfigParser.loadFromFile(app_path + std::string(CONFIG_FILE));
+    std::vector<std::string> translations_tasks;
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        translations_tasks.push_back("load_translations(" + std::filesystem::path(files[i]).stem().string() + ")");
+        startup.add(translations_tasks.back(), [&translations, &files, i]() {
+            translations[i].loadTranslationsFromFile(files[i]);
+        });
+    }
+
+    startup.add("merge_translations", [&translations]() {
+        for (const auto& manager : translations) abase::globalTranslationManager.merge(manager);
+    }, translations_tasks);
+
+    startup.run();
 }
 
-/// @brief Load all translations files
-void load_translations() {
-    std::string app_path = get_parser_value<std::string>("application_path");
+/// @brief Set the output language (from the configuration file or the command line)
+void set_language() {
     std::string lang = get_parser_value<std::string>("language");
-
-    abase::globalTranslationManager.loadAllTranslations(app_path + std::string(RESSOURCES_DIR));
     abase::globalTranslationManager.setCurrentLanguage(lang);
 }
 
@@ -37,8 +70,8 @@ void init::start(int argc, char* argv[]) {
     std::string app_path = abase::getAppPath(argv[0]);
     set_parser_value("application_path", app_path);
 
-    // initialization process
-    load_configuration();
+    // initialization process: the command line completes the configuration file, the language is then known
+    load_configuration_and_translations(app_path);
     parse_commands_line(argc, argv);
-    load_translations();
+    set_language();
 }
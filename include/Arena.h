@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+namespace abase {
+
+    /// @class Arena
+    /// @brief Bump allocator: memory is taken in large chunks and handed out by moving a pointer forward.
+    ///
+    /// A deallocation does nothing: all the memory is freed at once by the destructor. The arena is a memory
+    /// resource, so that it can be used by the `std::pmr` containers. The arena must be owned by a `std::shared_ptr`:
+    /// the objects created by `make_shared` hold a reference to it, so that the arena outlives every handle of its
+    /// objects (and the `std::pmr` storage of these objects).
+    class Arena : public std::pmr::memory_resource, public std::enable_shared_from_this<Arena> {
+        public:
+            /// @brief Default size of a chunk (in bytes)
+            static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+        private:
+            /// @brief size of a new chunk (in bytes)
+            std::size_t chunk_size;
+            /// @brief chunks of memory owned by the arena
+            std::vector<std::unique_ptr<std::byte[]>> chunks;
+            /// @brief first free byte of the current chunk
+            void* current = nullptr;
+            /// @brief number of free bytes in the current chunk
+            std::size_t remaining = 0;
+            /// @brief number of bytes handed out
+            std::size_t used = 0;
+
+            /// @brief Deleter of the objects created in the arena: the object is destroyed (its memory is freed with
+            /// the arena) and the reference to the arena is dropped with the deleter.
+            struct Releaser {
+                /// @brief arena storing the object
+                std::shared_ptr<Arena> arena;
+
+                template<typename T>
+                void operator()(T* object) const { object->~T(); }
+            };
+
+        protected:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void*, std::size_t, std::size_t) override {}
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        public:
+            /// @brief Constructor
+            /// @param size size of a chunk (in bytes)
+            explicit Arena(std::size_t size = DEFAULT_CHUNK_SIZE) : chunk_size(size) {};
+            Arena(const Arena&) = delete;
+            Arena& operator=(const Arena&) = delete;
+            ~Arena() override = default;
+
+            /// @brief Return the number of bytes handed out
+            std::size_t allocated() const { return used; }
+            /// @brief Return the number of chunks owned by the arena
+            std::size_t nb_chunks() const { return chunks.size(); }
+
+            /// @brief Create an object in the arena. The reference counter of the handle is allocated on the heap and
+            /// holds a reference to the arena, which is therefore released after the last handle of its objects.
+            /// @tparam T type of the object
+            /// @param args arguments of the constructor
+            /// @return shared pointer to the object
+            template<typename T, typename... Args>
+            std::shared_ptr<T> make_shared(Args&&... args) {
+                void* memory = allocate(sizeof(T), alignof(T));
+                T* object = new (memory) T(std::forward<Args>(args)...);
+                return std::shared_ptr<T>(object, Releaser{shared_from_this()});
+            }
+    };
+
+}
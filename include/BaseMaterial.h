@@ -0,0 +1,55 @@
+#pragma once
+
+#include "BinaryArchive.h"
+#include "Environment.h"
+#include "Commands.h"
+#include "FileReader.h"
+
+#include "FatigueLaw.h"
+
+namespace adata::parts {
+
+    /// @brief Base class for material properties
+    class BaseMaterial {
+        protected:
+
+        public:
+            /// @brief Identification of the material
+            std::string material_id = "";
+            /// @brief Identification of fatigue law associated to the material
+            std::string fatigue_law_id = "";
+            /// @brief Type of the material
+            std::string steel_type = "";
+            /// @brief Type of mean stress correction
+            std::string correction = "";
+            /// @brief Effective factor used during the mean stress correction
+            double Kf = 1.;
+            /// @brief M Coefficient used during elastic-plastic correction factor
+            double m = 0.;
+            /// @brief N Coefficient used during elastic-plastic correction factor
+            double n = 1.;
+
+            BaseMaterial() = default;
+            virtual ~BaseMaterial() = default;
+            BaseMaterial& operator=(const BaseMaterial& material);
+
+            /// @brief Command used to read the input file and initialize the object
+            /// @param command command read from the input file
+            virtual void init(const std::shared_ptr<abase::BaseCommand>& command);
+            /// @brief Verify if the object is correctly initialized
+            /// @param filecontext file input context
+            virtual void verify(const abase::FileContext& filecontext) const;
+
+            /// @brief Return the type of the material (command name in the material files)
+            virtual std::string get_type() const { return "BASE_MATERIAL"; }
+            /// @brief Write the object in a binary snapshot
+            /// @param writer binary writer
+            virtual void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the object from a binary snapshot
+            /// @param reader binary reader
+            virtual void load(abase::BinaryReader& reader);
+    };
+
+
+
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include <unordered_map>
+
+#include "DataCollector.h"
+#include "Environment.h"
+#include "BaseMaterial.h"
+#include "DrainMaterial.h"
+
+namespace adata {
+
+    using namespace adata::parts;
+
+    class BaseMaterialCollector : public abase::DataCollector {
+        private:
+            /// @brief Create a material object
+            /// @param type material type
+            /// @return material object
+            std::shared_ptr<BaseMaterial> create_material(const std::string& type) const;
+
+            /// @brief rank of each material by material_id
+            std::unordered_map<std::string, std::size_t> material_index;
+
+        protected:
+            /// @brief Convert read data from input file into data objects
+            /// @param command read data from the input file
+            /// @param filecontext file context
+            void set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext);
+
+            /// @brief Collection of materials
+            std::vector<std::shared_ptr<BaseMaterial>> materials;
+
+        public:
+            
+            BaseMaterialCollector() = default;
+            ~BaseMaterialCollector() = default;
+
+            /// @brief Get the material associated to a given identification
+            /// @param material_id material's identification
+            /// @return shared pointer to the material
+            std::shared_ptr<BaseMaterial> get_material(const std::string& material_id) const;
+
+            /// @brief Write the collection in a binary snapshot
+            /// @param writer binary writer
+            void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the collection from a binary snapshot
+            /// @param reader binary reader
+            /// @return false if the snapshot is corrupted
+            bool load(abase::BinaryReader& reader);
+
+            /// @brief Clear the collection of materials
+            void clear() { materials.clear(); material_index.clear(); }
+    };
+
+}
\ No newline at end of file
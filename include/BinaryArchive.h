@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace abase {
+
+    /// @class BinaryWriter
+    /// @brief Serialization of values in a binary buffer (native byte order, used for local cache files).
+    class BinaryWriter {
+        private:
+            /// @brief serialized values
+            std::string buffer;
+
+        public:
+            BinaryWriter() = default;
+
+            /// @brief Add raw bytes (without their size)
+            /// @param bytes bytes to add
+            void write_bytes(std::string_view bytes) { buffer.append(bytes.data(), bytes.size()); }
+            /// @brief Add an unsigned integer
+            void write(std::uint64_t value);
+            /// @brief Add a real value
+            void write(double value);
+            /// @brief Add a string (size and characters)
+            void write(const std::string& value);
+            /// @brief Add a vector of real values (size and values)
+            void write(const std::vector<double>& values);
+            /// @brief Add a vector of strings (size and strings)
+            void write(const std::vector<std::string>& values);
+
+            /// @brief Return the serialized values
+            const std::string& data() const { return buffer; }
+            /// @brief Write the serialized values in a file. The values are written in a temporary file which is then
+            /// renamed, so that a concurrent reader never sees a partial file.
+            /// @param filename name of the file
+            /// @return false if the file cannot be written
+            bool save(const std::string& filename) const;
+    };
+
+    /// @class BinaryReader
+    /// @brief Deserialization of values written by a BinaryWriter.
+    /// @details A reading past the end of the data sets the reader in a failed state: all the following readings
+    /// fail and `good` returns false, so that a truncated or corrupted file is detected once at the end.
+    class BinaryReader {
+        private:
+            /// @brief serialized values
+            std::string_view data;
+            /// @brief position of the next value
+            std::size_t position = 0;
+            /// @brief false after a failed reading
+            bool status = true;
+
+            /// @brief Take a block of bytes
+            /// @param size number of bytes
+            /// @return start of the block (nullptr on failure)
+            const char* take(std::size_t size);
+
+        public:
+            /// @brief Constructor
+            /// @param bytes serialized values (must stay valid while reading)
+            explicit BinaryReader(std::string_view bytes) : data(bytes) {};
+
+            /// @brief Return false if a reading has failed
+            bool good() const { return status; }
+            /// @brief Return true if all the data have been read
+            bool at_end() const { return position == data.size(); }
+
+            /// @brief Read raw bytes
+            /// @param size number of bytes
+            /// @return view on the bytes (empty on failure)
+            std::string_view read_bytes(std::size_t size);
+            /// @brief Read an unsigned integer
+            bool read(std::uint64_t& value);
+            /// @brief Read a real value
+            bool read(double& value);
+            /// @brief Read a string
+            bool read(std::string& value);
+            /// @brief Read a vector of real values
+            bool read(std::vector<double>& values);
+            /// @brief Read a vector of strings
+            bool read(std::vector<std::string>& values);
+    };
+
+}
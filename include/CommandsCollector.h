@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Commands.h"
+#include "CommandsTypeFactory.h"
+#include "Environment.h"
+#include "KeywordTrie.h"
+
+namespace abase {
+
+    /// @brief Factory class to create all commands read from an external file. This factory is defined by a YAML file. 
+    /// It is different from the CommandsTypeFactory class which is used to store all commands by their type.
+    
+    /// The factory is a singleton
+    class CommandsCollector {
+        private:
+            /// @brief Arena storing the command tree and the values read by the commands. The commands hold a
+            /// reference to it: a command kept after the collector is cleared or destroyed stays valid.
+            std::shared_ptr<Arena> arena = std::make_shared<Arena>();
+            /// @brief Collection of all commands available: name and associated command
+            std::unordered_map<std::string, std::shared_ptr<BaseCommand>> commands;
+            /// @brief Keywords of all commands and their children. Main commands are ranked in the iteration order 
+            /// of `commands`, children have the rank `CHILD_RANK`.
+            KeywordTrie keywords;
+            /// @brief Main commands by rank
+            std::vector<std::shared_ptr<BaseCommand>> ranked_commands;
+
+            /// @brief Rank given to the children commands in the keyword tree
+            static constexpr std::uint32_t CHILD_RANK = KeywordTrie::NO_RANK - 1;
+
+            /// @brief Add the keywords of a command and of its children in the keyword tree
+            /// @param command command to add
+            /// @param rank rank of the command
+            void add_keywords(const std::shared_ptr<BaseCommand>& command, std::uint32_t rank);
+            /// @brief Build the keyword tree from the commands
+            void build_keywords();
+
+        public:
+            CommandsCollector() = default;
+            ~CommandsCollector() = default;
+            CommandsCollector(const CommandsCollector&) = delete;
+            CommandsCollector& operator=(const CommandsCollector&) = delete;
+
+            /// @brief Load all commands from a YAML file
+            /// @param filename path to the YAML file
+            void loadCommandsFromFile(const std::string& filename);
+
+            /// @brief Get the command associated to a given name. The command is stored in the arena of the collector,
+            /// which is kept alive by the handles of its commands.
+            /// @param name command name
+            /// @return the command object
+            std::shared_ptr<BaseCommand> get_command(const std::string& name);
+            /// @brief Get the command name associated to a given keyword. The translation is taken into account.
+            /// @param keyword command keyword
+            /// @return the command name (empty if not found)
+            std::string get_command_name_by_keyword(const std::string& keyword) const;
+            /// @brief Get the main command associated to a given keyword. The translation is taken into account and 
+            /// the first command in the order of `get_commands_names` is returned when several commands match.
+            /// @param keyword command keyword
+            /// @return the command object (nullptr if not found)
+            std::shared_ptr<BaseCommand> get_command_by_keyword(const std::string& keyword) const;
+            /// @brief Get the list of all commands names
+            /// @return the list of commands names
+            std::vector<std::string> get_commands_names();
+
+            /// @brief Check if the input name is a command name
+            /// @param name name to check
+            /// @return status of the comparison
+            bool is_command_name(const std::string& name) const;
+            /// @brief Clear all commands. Their memory is freed at once with the arena, when no handle of the
+            /// commands remains.
+            void clear() { 
+                commands.clear();
+                keywords.clear();
+                ranked_commands.clear();
+                arena = std::make_shared<Arena>();
+            }
+    };
+
+}
\ No newline at end of file
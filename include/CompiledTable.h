@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Table.h"
+
+namespace amath {
+
+    /// \brief Table prepared for repeated interpolations of the ordinates.
+    ///
+    /// The abciss values are sorted once and the slope of each interval (and the logarithms for a logarithmic
+    /// interpolation) are computed when the table is compiled: an interpolation is then a binary search followed by
+    /// one multiply-add. The interpolated values are the same as the ones of Table::get_yvalue (same interval and
+    /// same rounding). Tables whose abciss values are not monotonic are interpolated with the original table.
+    /// The inverse interpolation of Table::get_xvalue is obtained by compiling the table with the abciss and
+    /// ordinate values swapped (see CompiledTable::inverse).
+    class CompiledTable {
+        private:
+            /// \brief original table (used when the abciss values are not sorted)
+            Table _table_;
+            /// \brief interpolation method: "linear" or "logarithmic"
+            std::string _method_ = "linear";
+            /// \brief true if the abciss values are in increasing or decreasing order
+            bool _sorted_ = false;
+            /// \brief true if the abciss values are in decreasing order
+            bool _decreasing_ = false;
+            /// \brief abciss values
+            std::vector<double> xvalues;
+            /// \brief origin of each interval (logarithms of the abciss values for a logarithmic interpolation)
+            std::vector<double> xorigins;
+            /// \brief ordinate values (logarithms for a logarithmic interpolation)
+            std::vector<double> yvalues;
+            /// \brief slope of each interval
+            std::vector<double> slopes;
+            /// \brief range of valid abciss values
+            double xmin = 0.;
+            double xmax = 0.;
+
+            /// \brief Return the rank of the first interval containing an abciss value (which must be valid)
+            std::size_t get_interval(double x) const;
+            /// \brief Return true if an abciss value can be interpolated
+            bool is_valid(double x) const { return x >= xmin && x <= xmax; }
+
+        public:
+            CompiledTable() = default;
+            /// \brief Compile a table for a given interpolation method
+            /// \param[in] table The table.
+            /// \param[in] method The interpolation method: "linear" or "logarithmic".
+            CompiledTable(const Table& table, const std::string& method);
+            /// \brief Compile a table for the interpolation of abciss values (same results as Table::get_xvalue)
+            /// \param[in] table The table.
+            /// \param[in] method The interpolation method: "linear" or "logarithmic".
+            static CompiledTable inverse(const Table& table, const std::string& method) {
+                return CompiledTable(Table(table.get_yvalues(), table.get_xvalues()), method);
+            }
+
+            /// \brief Return the interpolated ordinate at a given abciss value.
+            /// \param[in] x The abciss value.
+            /// \return The interpolated ordinate value.
+            double get_yvalue(double x) const;
+            /// \brief Return the interpolated ordinates for several abciss values. The abciss values outside the
+            /// table are not interpolated and their ordinates are set to NaN.
+            /// \param[in] x The abciss values.
+            /// \param[out] y The interpolated ordinate values.
+            void get_yvalues(const std::vector<double>& x, std::vector<double>& y) const;
+    };
+}
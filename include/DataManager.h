@@ -0,0 +1,116 @@
+#pragma once
+
+#include <deque>
+
+#include "BoundedQueue.h"
+#include "Environment.h"
+#include "DataCollector.h"
+
+#include "ProblemDescription.h"
+#include "ProblemFemInterface.h"
+#include "ProblemLoadstep.h"
+#include "ProblemMaterial.h"
+#include "ProblemPlate.h"
+#include "ProblemSection.h"
+#include "ProblemTable.h"
+#include "ProblemTorsor.h"
+#include "ProblemTransient.h"
+
+namespace adata {
+
+    using namespace adata::parts;
+
+    /// @brief Verified data published by the data manager while the input file is read (pipeline mode). The objects
+    /// are not copied: they are owned by the data manager and keep their address while the file is read.
+    struct StreamedData {
+        /// @brief verified loadstep (null for a section)
+        const ProblemLoadstep* loadstep = nullptr;
+        /// @brief verified section (null for a loadstep)
+        const ProblemSection* section = nullptr;
+        /// @brief rank of the loadstep or of the section in the input file
+        std::size_t rank = 0;
+    };
+
+    /// @brief Queue used to publish the verified data
+    using StreamedDataQueue = abase::BoundedQueue<StreamedData>;
+
+    class DataManager : public abase::DataCollector {
+        private:
+            /// @brief Read the title of the problem in the input file
+            /// @param reader file reader associated to the input file
+            /// @param collector commands collector used to read the input file
+            /// @return problem title as a vector of strings
+            std::vector<std::string> read_title(abase::FileReader& reader, const abase::CommandsCollector& collector);
+
+        protected:
+            /// @brief Convert read data from input file into data objects
+            /// @param command read data from the input file
+            /// @param filecontext file context
+            virtual void set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext);
+
+            /// @brief Read special line without any command
+            /// @param command_name name of the command linked to the special line
+            /// @param reader file reader associated to the input file
+            /// @param collector commands collector used to read the input file
+            virtual void read_special_line(const std::string& command_name, abase::FileReader& reader, 
+                                           const abase::CommandsCollector& collector);
+            /// @brief Return true if the pipeline queue has been closed by the analysis (the rest of the input file
+            /// is not read)
+            bool is_reading_stopped() const override { return pipeline != nullptr && pipeline->is_closed(); }
+
+            ProblemFemInterface fem_interface;
+            ProblemDescription description;
+            ProblemPlate plate;
+            ProblemTorsor torsor;
+            /// @brief loadsteps (deque: published loadsteps keep their address while the next ones are read)
+            std::deque<ProblemLoadstep> loadsteps;
+            std::vector<ProblemTransient> transients;
+            std::vector<ProblemTable> tables;
+            std::vector<ProblemMaterial> materials;
+            /// @brief sections (deque: published sections keep their address while the next ones are read)
+            std::deque<ProblemSection> sections;
+
+            /// @brief Queue receiving the verified loadsteps and sections (pipeline mode only)
+            StreamedDataQueue* pipeline = nullptr;
+
+        public:
+            DataManager() = default;
+            ~DataManager() = default;
+            
+            /// @brief Set the queue receiving each loadstep and each section as soon as it is verified, so that their
+            /// analysis can start while the rest of the input file is read. The cross-section checks are still done
+            /// by `verify` once the whole file is read. The queue is neither owned nor closed by the data manager.
+            /// @param queue pipeline queue (nullptr to disable the pipeline mode)
+            void set_pipeline(StreamedDataQueue* queue) { pipeline = queue; }
+            /// @brief Verify if the object is correctly initialized with consistent objects
+            void verify() const;
+
+            /// @brief Return the number of transients
+            std::size_t nb_transients() const { return transients.size(); }
+            /// @brief Return the number of loadsteps
+            std::size_t nb_loadsteps() const { return loadsteps.size(); }
+            /// @brief Return the number of materials
+            std::size_t nb_materials() const { return materials.size(); }
+            /// @brief Return the number of sections
+            std::size_t nb_sections() const { return sections.size(); }
+            /// @brief Return the number of tables
+            std::size_t nb_tables() const { return tables.size(); }
+            /// @brief Return the number of external torsors
+            std::size_t nb_torsors() const { return torsor.cards.size(); }
+
+            /// @brief Return a reference to a transient
+            /// @param name transient name
+            /// @return reference to the transient
+            const ProblemTransient& get_transient(const std::string& name) const;
+            /// @brief Return a reference to a transient
+            /// @param rank transient rank
+            /// @return reference to the transient
+            const ProblemTransient& get_transient(const std::size_t rank) const;
+            /// @brief Return a reference to a loadstep
+            /// @param rank loadstep rank
+            /// @return reference to the loadstep
+            const ProblemLoadstep& get_loadstep(const std::size_t rank) const;
+
+    };
+
+}
\ No newline at end of file
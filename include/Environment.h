@@ -0,0 +1,14 @@
+#pragma once
+
+// Standard usual include 
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ConfigParser.h"
+#include "ErrorManager.h"
+#include "TranslationManager.h"
+#include "String.h"
\ No newline at end of file
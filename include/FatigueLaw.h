@@ -0,0 +1,258 @@
+#pragma once
+#include <unordered_map>
+
+#include "BinaryArchive.h"
+#include "Environment.h"
+#include "Commands.h"
+#include "FileReader.h"
+#include "CompiledTable.h"
+#include "PolynomialCurve.h"
+#include "Table.h"
+
+namespace adata::parts {
+
+    /// @brief Value used as a flag to check if the Young modulus has been defined or not for experimental fatigue laws
+    inline constexpr double UNSET_YOUNG_MODULUS = 1.;
+    /// @brief Largest number of cycles of the curve of the polynomial fatigue laws
+    inline constexpr double POLYNOMIAL_FATIGUE_LAW_NMAX = 1e12;
+    
+    class FatigueLaw {
+        protected:
+            void general_verification(const abase::FileContext& filecontext) const;
+
+            /// @brief Set the generic parameters of the fatigue law (law_id, Ec, description, code_editions).
+            /// @note This function must be called by the init function of each derived class.
+            /// @param command values read from the input file
+            void set_generic_parameters(const std::shared_ptr<abase::BaseCommand>& command);
+            /// @brief Copy the generic parameters of the fatigue law (law_id, Ec, description, code_editions) 
+            /// to an other object.
+            /// @param other other fatigue law object 
+            void copy_generic_parameters(std::shared_ptr<FatigueLaw> other) const;
+            /// @brief Write the generic parameters of the fatigue law in a binary snapshot
+            /// @param writer binary writer
+            void save_generic_parameters(abase::BinaryWriter& writer) const;
+            /// @brief Read the generic parameters of the fatigue law from a binary snapshot
+            /// @param reader binary reader
+            void load_generic_parameters(abase::BinaryReader& reader);
+            /// @brief Convert a number of cycles to an allowable number of cycles: truncation of the values higher
+            /// than 1, 1 cycle for the lower and undefined (NaN) values, largest integer for the values out of its range
+            /// @param na number of cycles
+            static std::size_t to_cycles(double na);
+
+
+            std::unordered_map<std::string, std::string> descriptions;
+            std::unordered_map<std::string, std::vector<std::string>> editions;
+
+            /// @brief Young modulus of the material used to build the fatigue law
+            double Ec = 0.;
+            /// @brief Ponderation factor for number of cycles. A value of upper than 1. means that the material is 
+            /// more sensitive to the number of cycles.
+            double N_ratio = 1.;
+            /// @brief Identification of the fatigue law
+            std::string law_id = "";
+
+        public:
+
+            FatigueLaw() = default;
+            virtual ~FatigueLaw() = default;
+
+            std::string get_id() const { return law_id; }
+            bool support_code(const std::string& code, const std::string& description) const;
+            /// @brief Return true if the law is not linked to a construction code (it supports all codes)
+            bool is_code_free() const;
+            /// @brief Return the (code, edition) pairs supported by the law, with an empty edition for a code supported
+            /// whatever the edition (empty for a law without code link)
+            /// @return list of supported pairs
+            std::vector<std::pair<std::string, std::string>> supported_codes() const;
+
+            bool is_same_law(const FatigueLaw& other) const;
+
+
+            /// @brief Give the endurance limit associated to the fatigue law
+            /// @return endurance limit
+            virtual double endurance_limit() const = 0;
+            /// @brief Compute the allowable stress associated to a number of cycles
+            virtual double allowable_stress(std::size_t Na) const = 0;
+            /// @brief Compute the allowable number of cycles associated to a stress
+            virtual std::size_t allowable_cycles(double Sa) const = 0;
+            /// @brief Compute the allowable numbers of cycles associated to several stresses. No warning is issued
+            /// for the stresses higher than the fatigue curve: they are counted so that the caller can issue one
+            /// warning for the whole batch. The undefined (NaN) stresses give 1 allowable cycle.
+            /// @param Sa alternating stresses
+            /// @param[out] Na allowable numbers of cycles
+            /// @return number of stresses higher than the fatigue curve
+            virtual std::size_t allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const;
+            /// @brief Compute the allowable stresses associated to several numbers of cycles. No warning is issued
+            /// for the numbers of cycles lower than the fatigue curve: they are counted so that the caller can issue
+            /// one warning for the whole batch.
+            /// @param Na numbers of cycles
+            /// @param[out] Sa allowable stresses
+            /// @return number of numbers of cycles lower than the fatigue curve
+            virtual std::size_t allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const;
+            /// @brief Compute the Young modulus ratio \f $\frac{E_c}{E}$ \f
+            /// @param E Apparant Young modulus of the material
+            /// @return Young modulus ratio
+            double young_ratio(double E) const { return Ec / E; }
+
+            /// @brief Initialize the object with the values read from the input file
+            /// @param command values read from the input file
+            virtual void init(const std::shared_ptr<abase::BaseCommand>& command) = 0;
+
+            /// @brief Verify if the object is correctly initialized
+            /// @param filecontext context of the input file
+            /// @return status of the object initialization
+            virtual void verify(const abase::FileContext& filecontext) const = 0;
+
+            /// @brief Clone the current object
+            /// @return shared pointer to the cloned object
+            virtual std::shared_ptr<FatigueLaw> clone() const = 0;
+
+            /// @brief Return the type of the fatigue law (command name in the fatigue law files)
+            virtual std::string get_type() const = 0;
+            /// @brief Write the object in a binary snapshot
+            /// @param writer binary writer
+            virtual void save(abase::BinaryWriter& writer) const = 0;
+            /// @brief Read the object from a binary snapshot
+            /// @param reader binary reader
+            virtual void load(abase::BinaryReader& reader) = 0;
+    };
+
+
+    class TabularFatigueLaw : public FatigueLaw {
+        protected:
+            amath::Table table;
+            /// @brief log-log fatigue curve compiled for the interpolation of the stresses
+            amath::CompiledTable stress_curve;
+            /// @brief log-log fatigue curve compiled for the interpolation of the numbers of cycles
+            amath::CompiledTable cycles_curve;
+
+            /// @brief Compile the fatigue curves from the table
+            /// @note This function must be called each time the table is modified.
+            void compile();
+
+        public:
+
+            TabularFatigueLaw() = default;
+            virtual ~TabularFatigueLaw() = default;
+
+            /// @brief Give the endurance limit associated to the fatigue law
+            /// @return endurance limit
+            virtual double endurance_limit() const override { return table.get_ymin(); }
+            /// @brief Compute the allowable stress associated to a number of cycles
+            virtual double allowable_stress(std::size_t Na) const override;
+            /// @brief Compute the allowable number of cycles associated to a stress
+            virtual std::size_t allowable_cycles(double Sa) const override;
+            /// @brief Compute the allowable numbers of cycles associated to several stresses with the compiled
+            /// log-log fatigue curve (same values as the allowable_cycles function for a single stress)
+            virtual std::size_t allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const override;
+            /// @brief Compute the allowable stresses associated to several numbers of cycles with the compiled
+            /// log-log fatigue curve (same values as the allowable_stress function for a single number of cycles)
+            virtual std::size_t allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const override;
+
+            /// @brief Initialize the object with the values read from the input file
+            /// @param command values read from the input file
+            virtual void init(const std::shared_ptr<abase::BaseCommand>& command) override;
+
+            /// @brief Verify if the object is correctly initialized
+            /// @param filecontext context of the input file
+            /// @return status of the object initialization
+            virtual void verify(const abase::FileContext& filecontext) const override;
+
+            virtual std::shared_ptr<FatigueLaw> clone() const override;
+
+            virtual std::string get_type() const override { return "TABULAR_FATIGUE_LAW"; }
+            virtual void save(abase::BinaryWriter& writer) const override;
+            virtual void load(abase::BinaryReader& reader) override;
+    };
+
+    class PowerFatigueLaw : public FatigueLaw {
+        protected:
+            double alpha = 0.;
+            double beta = 0.;
+            double Seq = 0.;
+
+        public:
+            PowerFatigueLaw() = default;
+            virtual ~PowerFatigueLaw() = default;
+
+            /// @brief Give the endurance limit associated to the fatigue law
+            /// @return endurance limit
+            virtual double endurance_limit() const override { return Seq; }
+            /// @brief Compute the allowable stress associated to a number of cycles
+            virtual double allowable_stress(std::size_t Na) const override;
+            /// @brief Compute the allowable number of cycles associated to a stress
+            virtual std::size_t allowable_cycles(double Sa) const override;
+            /// @brief Compute the allowable numbers of cycles associated to several stresses with the log-log form
+            /// \f$ \log(N_a) = \log(\frac{\alpha}{N_{ratio}}) - \beta \log(S_a) \f$. The numbers of cycles before
+            /// truncation have a relative difference lower than 1e-13 with the allowable_cycles function for a
+            /// single stress (the truncated value may differ by one cycle at an integer boundary).
+            virtual std::size_t allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const override;
+            /// @brief Compute the allowable stresses associated to several numbers of cycles with the log-log form
+            /// (relative difference lower than 1e-13 with the allowable_stress function for a single number of cycles)
+            virtual std::size_t allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const override;
+
+            /// @brief Initialize the object with the values read from the input file
+            /// @param command values read from the input file
+            virtual void init(const std::shared_ptr<abase::BaseCommand>& command) override;
+
+            /// @brief Verify if the object is correctly initialized
+            /// @param filecontext context of the input file
+            /// @return status of the object initialization
+            virtual void verify(const abase::FileContext& filecontext) const override;
+         
+            virtual std::shared_ptr<FatigueLaw> clone() const override;
+
+            virtual std::string get_type() const override { return "POWER_FATIGUE_LAW"; }
+            virtual void save(abase::BinaryWriter& writer) const override;
+            virtual void load(abase::BinaryReader& reader) override;
+    };
+
+    class PolynomialFatigueLaw : public FatigueLaw {
+        protected:
+            std::vector<double> coefficients;
+            double beta = 0.;
+            double Seq = 0.;
+            /// @brief fatigue curve \f$ S_a(N_a N_{ratio}) \f$ compiled for the evaluations and inversions
+            amath::PolynomialCurve curve;
+
+            /// @brief Compile the fatigue curve from the coefficients
+            /// @note This function must be called each time the coefficients are modified.
+            void compile();
+        public:
+
+            PolynomialFatigueLaw() = default;
+            virtual ~PolynomialFatigueLaw() = default;
+
+            /// @brief Give the endurance limit associated to the fatigue law
+            /// @return endurance limit
+            virtual double endurance_limit() const override { return Seq; };
+            /// @brief Compute the allowable stress associated to a number of cycles
+            virtual double allowable_stress(std::size_t Na) const override;
+            /// @brief Compute the allowable number of cycles associated to a stress: smallest number of cycles
+            /// in \f$ [1, N_{max}] \f$ whose allowable stress is lower than the stress (monotone inverse of the
+            /// polynomial curve, relative tolerance amath::POLYNOMIAL_INVERSE_TOLERANCE before rounding up)
+            virtual std::size_t allowable_cycles(double Sa) const override;
+            /// @brief Compute the allowable numbers of cycles associated to several stresses with the compiled curve
+            /// (same values as the allowable_cycles function for a single stress)
+            virtual std::size_t allowable_cycles(const std::vector<double>& Sa, std::vector<std::size_t>& Na) const override;
+            /// @brief Compute the allowable stresses associated to several numbers of cycles with the compiled curve
+            /// (same values as the allowable_stress function for a single number of cycles)
+            virtual std::size_t allowable_stress(const std::vector<std::size_t>& Na, std::vector<double>& Sa) const override;
+
+            /// @brief Initialize the object with the values read from the input file
+            /// @param command values read from the input file
+            virtual void init(const std::shared_ptr<abase::BaseCommand>& command) override;
+
+            /// @brief Verify if the object is correctly initialized
+            /// @param filecontext context of the input file
+            /// @return status of the object initialization
+            virtual void verify(const abase::FileContext& filecontext) const override;
+
+            virtual std::shared_ptr<FatigueLaw> clone() const override;
+
+            virtual std::string get_type() const override { return "POLYNOMIAL_FATIGUE_LAW"; }
+            virtual void save(abase::BinaryWriter& writer) const override;
+            virtual void load(abase::BinaryReader& reader) override;
+    };
+
+}
\ No newline at end of file
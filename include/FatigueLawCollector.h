@@ -0,0 +1,64 @@
+#pragma once
+#include <unordered_map>
+
+#include "DataCollector.h"
+#include "Environment.h"
+#include "FatigueLaw.h"
+
+namespace adata {
+
+    using namespace adata::parts;
+    
+    class FatigueLawCollector : public abase::DataCollector {
+        private:
+            /// @brief Create a fatigue law object based on the type
+            /// @param type fatigue law type
+            /// @return fatigue law object
+            std::shared_ptr<FatigueLaw> create_law(const std::string& type) const;
+            /// @brief Add a fatigue law to the collection and to the indexes
+            /// @param law fatigue law
+            void add_law(const std::shared_ptr<FatigueLaw>& law);
+            /// @brief Return the key of a supported (law_id, code, edition) triplet in the index
+            static std::string law_key(const std::string& law_id, const std::string& code, const std::string& edition);
+
+            /// @brief ranks of the laws by law_id (in the order of the collection)
+            std::unordered_map<std::string, std::vector<std::size_t>> laws_by_id;
+            /// @brief rank of the first law without code link by law_id (such a law supports all codes)
+            std::unordered_map<std::string, std::size_t> code_free_laws;
+            /// @brief rank of the first law supporting a (law_id, code, edition) triplet, with an empty edition for
+            /// the laws supporting the code whatever the edition
+            std::unordered_map<std::string, std::size_t> code_laws;
+
+        protected:
+            /// @brief Convert read data from input file into data objects
+            /// @param command read data from the input file
+            /// @param filecontext file context
+            virtual void set_data(const std::shared_ptr<abase::BaseCommand>& command, const abase::FileContext& filecontext);
+
+            /// @brief Collection of fatigue laws
+            std::vector<std::shared_ptr<FatigueLaw>> laws;
+
+        public:            
+            FatigueLawCollector() = default;
+            ~FatigueLawCollector() = default;
+
+            /// @brief Get the fatigue law associated to a given identification
+            /// @param law_id identification of the fatigue law
+            /// @param code construction code of the fatigue law
+            /// @param edition construction code edition of the fatigue law
+            /// @return shared pointer to the fatigue law
+            std::shared_ptr<FatigueLaw> get_law(const std::string& law_id, 
+                                                const std::string& code, const std::string& edition) const;
+
+            /// @brief Write the collection in a binary snapshot
+            /// @param writer binary writer
+            void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the collection from a binary snapshot
+            /// @param reader binary reader
+            /// @return false if the snapshot is corrupted
+            bool load(abase::BinaryReader& reader);
+
+            /// @brief Clear the collection of fatigue laws
+            void clear();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Environment.h"
+
+#include "BaseMaterial.h"
+#include "FatigueLaw.h"
+#include "MaterialStates.h"
+
+namespace adata::parts {
+
+    /// @brief Pairs of states evaluated together by FatigueUsageBatch (one value by pair in each array)
+    struct PairBatch {
+        /// @brief rank of the first state of each pair
+        std::vector<std::size_t> state1;
+        /// @brief rank of the second state of each pair
+        std::vector<std::size_t> state2;
+        /// @brief primary plus secondary stress range \f$ S_n \f$ of each pair
+        std::vector<double> Sn;
+        /// @brief total stress range \f$ S_p \f$ of each pair
+        std::vector<double> Sp;
+
+        /// @brief Return the number of pairs
+        std::size_t size() const { return Sn.size(); }
+        /// @brief Remove all the pairs
+        void clear();
+        /// @brief Add a pair
+        /// @param s1 rank of the first state
+        /// @param s2 rank of the second state
+        /// @param sn primary plus secondary stress range
+        /// @param sp total stress range
+        void add(std::size_t s1, std::size_t s2, double sn, double sp);
+    };
+
+    /// @brief Results of FatigueUsageBatch (one value by pair in each array)
+    struct UsageBatchResults {
+        /// @brief elastic-plastic correction factor \f$ K_e \f$
+        std::vector<double> Ke;
+        /// @brief alternating stress \f$ S_{alt} \f$
+        std::vector<double> Salt;
+        /// @brief allowable number of cycles
+        std::vector<std::size_t> cycles;
+        /// @brief usage factor of one cycle (0 below the endurance limit)
+        std::vector<double> usage;
+        /// @brief number of alternating stresses higher than the fatigue curve
+        std::size_t nb_above_curve = 0;
+    };
+
+    /// @brief Batched computation of the fatigue usage of pairs of states: \f$ K_e(S_n, S_m) \f$, then
+    /// \f$ S_{alt} = \frac{1}{2} K_e S_p \frac{E_c}{E} \f$, then the allowable number of cycles of the fatigue law.
+    /// @details \f$ K_e \f$ is computed without branches:
+    /// \f$ K_e = 1 + \frac{1 - n}{n (m - 1)} \min\left(\max\left(\frac{S_n}{3 S_m} - 1, 0\right), m - 1\right) \f$,
+    /// which is 1 for \f$ S_n \le 3 S_m \f$ and \f$ \frac{1}{n} \f$ for \f$ S_n \ge 3 m S_m \f$ (\f$ K_e = 1 \f$ if
+    /// \f$ m \le 1 \f$). \f$ S_m \f$ and \f$ \frac{E_c}{E} \f$ are read from the per-state values of MaterialStates
+    /// (mean of the two states for \f$ S_m \f$). The allowable numbers of cycles are computed for the whole batch
+    /// and a single warning is issued for the alternating stresses higher than the fatigue curve. An error is raised
+    /// if an alternating stress is undefined (\f$ S_m \f$ or \f$ E \f$ not defined for the material, or temperature
+    /// outside their tables).
+    class FatigueUsageBatch {
+        private:
+            /// @brief fatigue law of the material
+            std::shared_ptr<const FatigueLaw> _law_;
+            /// @brief slope of \f$ K_e \f$ with respect to \f$ \frac{S_n}{3 S_m} \f$
+            double ke_slope = 0.;
+            /// @brief range of \f$ \frac{S_n}{3 S_m} - 1 \f$ on which \f$ K_e \f$ varies
+            double ke_span = 0.;
+
+        public:
+            /// @brief Constructor
+            /// @param material base material (coefficients m and n of \f$ K_e \f$)
+            /// @param law fatigue law of the material
+            FatigueUsageBatch(const BaseMaterial& material, std::shared_ptr<const FatigueLaw> law);
+
+            /// @brief Compute the usage of a batch of pairs
+            /// @param pairs pairs of states
+            /// @param states material properties of the states
+            /// @param EcE_type type of temperature dependence of \f$ \frac{E_c}{E} \f$: "none", "mean", "min" or "max"
+            /// @param[out] results results for each pair
+            void evaluate(const PairBatch& pairs, const MaterialStates& states, const std::string& EcE_type,
+                          UsageBatchResults& results) const;
+    };
+}
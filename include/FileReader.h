@@ -0,0 +1,81 @@
+#pragma once
+
+#include <queue>
+
+#include "Environment.h"
+#include "FileContext.h"
+#include "LineReader.h"
+
+namespace abase {
+
+    /// @class FileLineFilter
+    /// @brief Provides utility functions for filtering lines of text.
+    ///
+    /// The FileLineFilter class splits a line of text into words in a single pass: comments (starting with a 
+    /// `COMMENT_DELIMITER` character) are suppressed, the leading `*` marker is removed and quoted words are kept
+    /// as a single word. Words are given as views on the line, without any allocation.
+    class FileLineFilter {
+        public:
+            /// @brief Split a line of text into words.
+            /// @param line The line of text to be filtered.
+            /// @return A vector of strings, where each string represents a word in the line.
+            static std::vector<std::string> filter(const std::string& line);
+            /// @brief Split a line of text into words given as views on the line.
+            /// @param line The line of text to be filtered.
+            /// @param[out] words vector of views (cleared before filtering), valid as long as the line is unchanged.
+            static void filter(std::string_view line, std::vector<std::string_view>& words);
+    };
+
+
+    /// @class FileReader
+    /// @brief Provides functionality for reading and navigating through a file line by line.
+    ///
+    /// The FileReader class is responsible for reading a file and providing methods to access the
+    /// words in the file. Regular files are memory-mapped (see \ref LineReader) and the current line and words
+    /// are views on the mapping.
+    ///
+    /// A FileReader object must be used by a single thread.
+    class FileReader {
+        private:
+            /// @brief previous line of the file (only used for error messages)
+            std::string_view prev_line;
+            /// @brief current line of the file
+            std::string_view line;
+            /// @brief copy of the previous line when the file is not memory-mapped
+            std::string prev_storage;
+            /// @brief buffer of words (views on the current line) for current line
+            std::vector<std::string_view> buffer;
+            /// @brief current position on the current line (which word)
+            std::size_t word_rk = 0;
+            /// @brief current line number (only used for error messages)
+            std::size_t line_number = 0;
+            
+            /// @brief file name
+            std::string filename;
+            /// @brief identifier of the file for the error contexts
+            std::uint32_t file_id = FileContext::NO_FILE;
+            /// @brief line reader of the input file
+            LineReader input;
+
+            /// @brief Update the buffer with a new line
+            void buffer_update();
+
+        public:
+            /// @brief Constructor
+            /// @param input_name name of the input file
+            FileReader(const std::string& input_name);
+            /// @brief return the current word in the buffer
+            std::string get_word();
+            /// @brief move forward from one word in the buffer
+            void move();
+            /// @brief move forward from one line in the buffer
+            void move_line();
+            /// @brief return the current line in the buffer
+            std::string get_line() { return std::string(line); }
+            /// @brief return the context of the current line, rendered only when an error occurs
+            FileContext context() const;
+            /// @brief return a standard error message with the current line
+            std::string context_error() const { return context().render(); }
+    };
+
+}
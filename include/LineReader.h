@@ -0,0 +1,85 @@
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace abase {
+
+    /// @class LineReader
+    /// @brief Sequential reader of the lines of a file.
+    ///
+    /// Regular files are memory-mapped (see \ref MappedFile) and each line is given as a view on the mapping, without
+    /// any copy. The mapping can be shared with the error contexts and outlive the reader. The offsets of the lines
+    /// are indexed lazily while reading. Other files (pipes, character devices, ...) are read through a buffered
+    /// stream and each line is given as a view on an internal buffer.
+    class LineReader {
+        private:
+            /// @brief file name
+            std::string filename;
+            /// @brief opening status
+            bool opened = false;
+
+            /// @brief mapping of the file (nullptr for a buffered reading)
+            std::shared_ptr<const MappedFile> mapping;
+            /// @brief start of the mapping (nullptr for an empty file or a buffered reading)
+            const char* data = nullptr;
+            /// @brief size of the mapping
+            std::size_t size = 0;
+            /// @brief offset of the next line in the mapping
+            std::size_t offset = 0;
+            /// @brief true if the file is memory-mapped
+            bool mapped = false;
+            /// @brief offsets of the lines already read in the mapping (lazy index)
+            std::vector<std::size_t> offsets;
+
+            /// @brief input stream for buffered reading
+            std::ifstream input;
+            /// @brief buffer of the current line for buffered reading
+            std::string storage;
+
+            /// @brief number of lines already read
+            std::size_t nb_lines = 0;
+
+            /// @brief Try to map a regular file
+            /// @return true if the file is memory-mapped
+            bool map_file();
+
+        public:
+            /// @brief Constructor
+            /// @param input_name name of the file
+            LineReader(const std::string& input_name);
+
+            LineReader(const LineReader&) = delete;
+            LineReader& operator=(const LineReader&) = delete;
+
+            /// @brief Return true if the file is open
+            bool is_open() const { return opened; }
+            /// @brief Return true if the file is memory-mapped
+            bool is_mapped() const { return mapped; }
+            /// @brief Return the mapping of the file (nullptr for a buffered reading)
+            std::shared_ptr<const MappedFile> get_mapping() const { return mapping; }
+            /// @brief Return the number of lines already read
+            std::size_t line_number() const { return nb_lines; }
+
+            /// @brief Read the next line (without the end of line character)
+            /// @param[out] line view on the line. For a mapped file, the view is valid as long as the reader exists.
+            /// For a buffered reading, the view is valid up to the next call. At the end of the file, the view is empty, 
+            /// except just after an unterminated last line where it is unchanged (same behaviour as `std::getline`).
+            /// @return false at the end of the file
+            bool next(std::string_view& line);
+            /// @brief Return the offset in the file of a line read from a mapped file
+            /// @param line view on the line given by `next`
+            /// @return offset of the line (maximum value for a buffered reading or an empty view)
+            std::size_t offset_of(std::string_view line) const;
+            /// @brief Return a line already read of a mapped file (empty view for a buffered reading)
+            /// @param number line number (starting at 1)
+            /// @return view on the line
+            std::string_view get_line(std::size_t number) const;
+    };
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "BinaryArchive.h"
+#include "Commands.h"
+#include "Environment.h"
+#include "FileReader.h"
+
+namespace adata::parts {
+
+    /// @brief Class to store coefficients for perforated plates. Coefficients are stored for one unique value of 
+    // \f$ P/h \f$ ratio. 
+    class PlateCoefficients {
+        private :      
+
+        public:
+            /// @brief Identification of the function (only used for the collector)
+            std::string function_id;
+            /// @brief Description of the function (only used for the collector)
+            std::string description;
+
+            /// @brief \f$ P/h \f$ ratio
+            double Ph = 0.;
+            /// @brief list of angles values
+            std::vector<double> angles;
+            /// @brief list of \f$ a_{phi} \f$ coefficients
+            std::vector<double> a_phi;
+            /// @brief list of \f$ b_{phi} \f$ coefficients
+            std::vector<double> b_phi;
+            /// @brief list of \f$ c_{phi} \f$ coefficients
+            std::vector<double> c_phi;
+
+            /// @brief Clear the object values
+            void clear();
+
+            PlateCoefficients() = default;
+            virtual ~PlateCoefficients() = default;
+
+            /// @brief Initialize the object with the values read from the input file
+            /// @param command values read from the input file
+            void init(const std::shared_ptr<abase::BaseCommand>& command);
+            /// @brief Verify the coherence of object values
+            /// @param filecontext file content
+            void verify(const abase::FileContext& filecontext) const;
+
+            /// @brief Write the object in a binary snapshot
+            /// @param writer binary writer
+            void save(abase::BinaryWriter& writer) const;
+            /// @brief Read the object from a binary snapshot
+            /// @param reader binary reader
+            void load(abase::BinaryReader& reader);
+    };
+
+
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Stress.h"
+
+namespace amath {
+
+    /// \brief Stress of a perforated plate relocalised with the coefficients of an angle \f$ \phi \f$:
+    /// \f$ S(\phi) = a_{\phi} A + b_{\phi} B + c_{\phi} C + D \f$.
+    struct RelocalisedStress {
+        /// \brief stress multiplied by \f$ a_{\phi} \f$
+        Stress a;
+        /// \brief stress multiplied by \f$ b_{\phi} \f$
+        Stress b;
+        /// \brief stress multiplied by \f$ c_{\phi} \f$
+        Stress c;
+        /// \brief stress independent of the angle
+        Stress d;
+
+        /// \brief Return the relocalised stress for given coefficients.
+        Stress at(double a_phi, double b_phi, double c_phi) const;
+    };
+
+    /// \brief Computation of the relocalised stresses of a plate for a whole list of angles.
+    ///
+    /// The angles are folded with the periodicity of the relocalisation coefficients: \f$ a_{\phi} \f$,
+    /// \f$ b_{\phi} \f$ and \f$ c_{\phi} \f$ are symmetric about 180°, and \f$ a_{\phi} \f$ and \f$ b_{\phi} \f$ are
+    /// symmetric about 90° while \f$ c_{\phi} \f$ is anti-symmetric. The angles are grouped by their coefficients
+    /// \f$ (a_{\phi}, b_{\phi}, |c_{\phi}|) \f$: for each group, the products \f$ a_{\phi} A + b_{\phi} B \f$ and
+    /// \f$ |c_{\phi}| C \f$ are computed once (small dense matrix product), and the equivalent stress is computed
+    /// once for each sign of \f$ c_{\phi} \f$. The angles are compared through their coefficients, so that the
+    /// results are exactly the ones of RelocalisedStress::at for each angle. This identity requires the same
+    /// rounding of each product: the contraction of the products into FMA instructions is disabled for this file
+    /// (`-ffp-contract=off`, see the amath CMakeLists).
+    class PlateStressKernel {
+        private:
+            /// \brief values of \f$ a_{\phi} \f$ for each group of angles
+            std::vector<double> group_a;
+            /// \brief values of \f$ b_{\phi} \f$ for each group of angles
+            std::vector<double> group_b;
+            /// \brief values of \f$ |c_{\phi}| \f$ for each group of angles
+            std::vector<double> group_c;
+            /// \brief rank of the folded stress of each angle: \f$ 2 \times \f$ group \f$ + 1 \f$ if the sign bit of
+            /// \f$ c_{\phi} \f$ is set
+            std::vector<std::size_t> folded_rank;
+            /// \brief true if the folded stress is used by an angle
+            std::vector<bool> folded_used;
+            /// \brief method used to compute the equivalent stress
+            std::string equivalent_stress_method = "tresca";
+
+            /// \brief Return the equivalent stress of a stress tensor
+            double equivalent(const Stress& stress) const;
+            /// \brief Compute the distinct stresses of the angles (by folded rank)
+            /// \param stress relocalised stress
+            /// \param[out] folded stresses by folded rank (only the used ones are computed)
+            void fold(const RelocalisedStress& stress, std::vector<Stress>& folded) const;
+
+        public:
+            PlateStressKernel() = default;
+            /// \brief Constructor
+            /// \param a values of \f$ a_{\phi} \f$ for each angle
+            /// \param b values of \f$ b_{\phi} \f$ for each angle
+            /// \param c values of \f$ c_{\phi} \f$ for each angle
+            /// \param method equivalent stress method: "tresca", "mises" or "reduced_mises"
+            PlateStressKernel(const std::vector<double>& a, const std::vector<double>& b,
+                              const std::vector<double>& c, const std::string& method = "tresca");
+
+            /// \brief Return the number of angles
+            std::size_t nb_angles() const { return folded_rank.size(); }
+            /// \brief Return the number of distinct stresses computed for the angles
+            std::size_t nb_folded() const;
+
+            /// \brief Compute the relocalised stresses of all the angles
+            /// \param stress relocalised stress
+            /// \param[out] tensors stress of each angle
+            void relocalise(const RelocalisedStress& stress, std::vector<Stress>& tensors) const;
+            /// \brief Compute the equivalent stresses of all the angles
+            /// \param stress relocalised stress
+            /// \param[out] values equivalent stress of each angle
+            void evaluate(const RelocalisedStress& stress, std::vector<double>& values) const;
+            /// \brief Compute the equivalent stresses of all the angles for several stresses (for instance the pairs
+            /// of load steps of a transient pair)
+            /// \param stresses relocalised stresses
+            /// \param[out] values equivalent stresses, by stress then by angle
+            void evaluate(const std::vector<RelocalisedStress>& stresses, std::vector<double>& values) const;
+    };
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+namespace amath {
+
+    /// \brief Relative tolerance on the abciss values computed by PolynomialCurve::inverse.
+    static constexpr double POLYNOMIAL_INVERSE_TOLERANCE = 1e-12;
+    /// \brief Maximal number of safeguarded Newton steps of PolynomialCurve::inverse.
+    static constexpr std::size_t POLYNOMIAL_INVERSE_MAX_ITERATIONS = 60;
+
+    /// \brief Decreasing curve defined by a polynomial \f$ y = \sum_i c_i x^i \f$ on an interval
+    /// \f$ [x_{min}, x_{max}] \f$, prepared for repeated evaluations and inversions.
+    ///
+    /// The polynomial is not necessarily monotonic: the inverse of an ordinate \f$ y \f$ is defined as the smallest
+    /// abciss \f$ x \f$ such that \f$ p(x) \le y \f$, which is a non-increasing function of \f$ y \f$. The interval
+    /// is sampled once on logarithmically spaced knots and the running minimum of the polynomial on the knots gives
+    /// the bracket of each inversion (binary search). The root is then refined in the bracket by Newton steps,
+    /// with a bisection when a step leaves the bracket, up to a relative tolerance POLYNOMIAL_INVERSE_TOLERANCE.
+    /// A crossing of the ordinate between two knots whose values are both higher is not detected: the knots must
+    /// be dense enough for the variations of the polynomial.
+    class PolynomialCurve {
+        private:
+            /// \brief coefficients of the polynomial (increasing degrees)
+            std::vector<double> coefficients;
+            /// \brief coefficients of the derivative (increasing degrees)
+            std::vector<double> derivatives;
+            /// \brief knots of the interval
+            std::vector<double> knots;
+            /// \brief running minimum of the polynomial on the knots
+            std::vector<double> minima;
+
+        public:
+            PolynomialCurve() = default;
+            /// \brief Constructor
+            /// \param[in] coefficients The coefficients of the polynomial (increasing degrees).
+            /// \param[in] xmin The lower bound of the interval (strictly positive).
+            /// \param[in] xmax The upper bound of the interval.
+            /// \param[in] knots_by_decade The number of knots by decade of the interval.
+            PolynomialCurve(const std::vector<double>& coefficients, double xmin, double xmax,
+                            std::size_t knots_by_decade = 64);
+
+            /// \brief Return the value of the polynomial (Horner scheme).
+            double value(double x) const;
+            /// \brief Return the values of the polynomial for several abciss values.
+            void values(const std::vector<double>& x, std::vector<double>& y) const;
+
+            /// \brief Return the maximal ordinate of the curve (value at the lower bound of the interval)
+            double get_ymax() const { return minima.front(); }
+            /// \brief Return the minimal ordinate of the curve on the interval
+            double get_ymin() const { return minima.back(); }
+
+            /// \brief Return the smallest abciss value of the interval such that \f$ p(x) \le y \f$.
+            /// \param[in] y The ordinate value.
+            /// \return The abciss value: the lower bound of the interval if \f$ y \f$ is higher than the curve,
+            /// NaN if \f$ y \f$ is lower than the curve on the whole interval.
+            double inverse(double y) const;
+            /// \brief Return the inverses of several ordinate values (see PolynomialCurve::inverse).
+            void inverse(const std::vector<double>& y, std::vector<double>& x) const;
+    };
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace abase {
+
+    /// @class RangeList
+    /// @brief List of unsigned values stored as runs of arithmetic progressions (first value, last value, step).
+    ///
+    /// A range such as `1 TO 100000 STEP 1` is stored as a single run, so that the memory and the time needed to
+    /// build the list do not depend on the number of values. The values keep the order in which they were added
+    /// (duplicates are allowed). The list is traversed with its iterators; the values are only expanded into a
+    /// vector by `to_vector` when it is really needed.
+    class RangeList {
+        public:
+            /// @brief Run of values: first, first + step, ..., last
+            struct Run {
+                /// @brief first value
+                std::size_t first = 0;
+                /// @brief last value
+                std::size_t last = 0;
+                /// @brief increment between two values
+                std::size_t step = 1;
+
+                /// @brief Return the number of values of the run
+                std::size_t size() const { return (last - first) / step + 1; }
+            };
+
+            /// @class const_iterator
+            /// @brief Forward iterator over the values of the list
+            class const_iterator {
+                private:
+                    /// @brief runs of the list
+                    const std::vector<Run>* runs = nullptr;
+                    /// @brief rank of the current run
+                    std::size_t run = 0;
+                    /// @brief current value
+                    std::size_t value = 0;
+
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = std::size_t;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const std::size_t*;
+                    using reference = const std::size_t&;
+
+                    const_iterator() = default;
+                    /// @brief Constructor
+                    /// @param list_runs runs of the list
+                    /// @param rank rank of the run (number of runs for the end iterator)
+                    const_iterator(const std::vector<Run>* list_runs, std::size_t rank) : runs(list_runs), run(rank) {
+                        if (run < runs->size()) value = (*runs)[run].first;
+                    }
+
+                    reference operator*() const { return value; }
+                    pointer operator->() const { return &value; }
+                    const_iterator& operator++() {
+                        if (value != (*runs)[run].last) {
+                            value += (*runs)[run].step;
+                        } else if (++run < runs->size()) {
+                            value = (*runs)[run].first;
+                        } else {
+                            value = 0;
+                        }
+                        return *this;
+                    }
+                    const_iterator operator++(int) { const_iterator it = *this; ++(*this); return it; }
+                    bool operator==(const const_iterator& other) const {
+                        return run == other.run && value == other.value;
+                    }
+                    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+            };
+
+        private:
+            /// @brief runs of values
+            std::vector<Run> runs;
+            /// @brief number of values before each run
+            std::vector<std::size_t> offsets;
+            /// @brief number of values
+            std::size_t count = 0;
+            /// @brief true if each value is greater than the previous one
+            bool increasing = true;
+
+            /// @brief Add a new run at the end of the list
+            /// @param run run to add
+            void add_run(const Run& run);
+            /// @brief Update the increasing status from the runs
+            void update_order();
+
+        public:
+            RangeList() = default;
+            /// @brief Constructor from a vector of values
+            /// @param values values of the list
+            explicit RangeList(const std::vector<std::size_t>& values);
+
+            /// @brief Remove all values
+            void clear();
+            /// @brief Return true if the list has no value
+            bool empty() const { return count == 0; }
+            /// @brief Return the number of values
+            std::size_t size() const { return count; }
+            /// @brief Return the number of runs
+            std::size_t nb_runs() const { return runs.size(); }
+            /// @brief Return the runs of values
+            const std::vector<Run>& get_runs() const { return runs; }
+
+            /// @brief Add a value at the end of the list
+            /// @param value value to add
+            void push_back(std::size_t value);
+            /// @brief Add the values first, first + step, ... up to bound at the end of the list
+            /// @param first first value
+            /// @param bound upper bound of the values (included)
+            /// @param step increment between two values (must not be zero)
+            void add_range(std::size_t first, std::size_t bound, std::size_t step);
+            /// @brief Add an offset to all values, with the wrap-around of unsigned integers for each value (same
+            /// values as a vector whose values are shifted one by one). A run whose values do not all wrap around is
+            /// split in two runs.
+            /// @param offset offset to add
+            void shift(std::ptrdiff_t offset);
+
+            /// @brief Return a value by its rank in the list (logarithmic in the number of runs)
+            /// @param rank rank of the value
+            /// @return the value
+            std::size_t operator[](std::size_t rank) const;
+            /// @brief Return the maximum value (0 for an empty list)
+            std::size_t max() const;
+            /// @brief Return the number of distinct values
+            std::size_t nb_distinct() const;
+            /// @brief Expand the list into a vector of values
+            std::vector<std::size_t> to_vector() const;
+
+            const_iterator begin() const { return const_iterator(&runs, 0); }
+            const_iterator end() const { return const_iterator(&runs, runs.size()); }
+    };
+
+}
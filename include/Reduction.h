@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+namespace amath {
+
+    /// @brief Storage of the partial results of parallel tasks. Each task writes its own slot and the partial results
+    /// are merged in the order of the task ranks, so that the result does not depend on the completion order of the
+    /// tasks (fixed-order floating-point summation and reproducible selection of maxima).
+    /// @tparam T type of the partial results
+    template<typename T>
+    class OrderedReduction {
+        private:
+            /// @brief partial results (one by task)
+            std::vector<T> partials;
+
+        public:
+            /// @brief Constructor
+            /// @param nb_tasks number of tasks
+            /// @param init initial value of each partial result
+            OrderedReduction(std::size_t nb_tasks, const T& init = T()) : partials(nb_tasks, init) {}
+
+            /// @brief Return the number of partial results
+            std::size_t size() const { return partials.size(); }
+            /// @brief Return the partial result of a task
+            /// @param task task rank
+            T& operator[](std::size_t task) { return partials[task]; }
+            /// @brief Return the partial result of a task
+            /// @param task task rank
+            const T& operator[](std::size_t task) const { return partials[task]; }
+            /// @brief Return the partial results in the order of the task ranks
+            const std::vector<T>& values() const { return partials; }
+
+            /// @brief Merge the partial results in the order of the task ranks
+            /// @param init initial value of the result
+            /// @param merge binary function `void merge(T& result, const T& partial)`
+            /// @return merged result
+            template<typename Merge>
+            T reduce(T init, Merge merge) const {
+                for (const auto& partial : partials) merge(init, partial);
+                return init;
+            }
+    };
+
+    /// @brief Compensated sum of values in a fixed order (increasing rank). The rounding error of each addition is
+    /// accumulated separately (Neumaier summation), so that the result does not depend on the magnitude of the
+    /// partial sums and is reproducible for a given number of tasks.
+    /// @param values values to sum
+    /// @return sum of values
+    inline double ordered_sum(const std::vector<double>& values) {
+        double sum = 0.;
+        double compensation = 0.;
+        for (const auto& value : values) {
+            double total = sum + value;
+            if (std::abs(sum) >= std::abs(value)) {
+                compensation += (sum - total) + value;
+            } else {
+                compensation += (value - total) + sum;
+            }
+            sum = total;
+        }
+        return sum + compensation;
+    }
+
+}
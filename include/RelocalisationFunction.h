@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+
+#include "Environment.h"
+
+#include "PlateCoefficients.h"
+
+namespace adata::parts {
+
+    /// @brief Types of relocalisation coefficients (rank of the coefficient in a relocalisation function)
+    enum class RelocalisationCoefficient : std::size_t { A_PHI = 0, B_PHI = 1, C_PHI = 2 };
+    /// @brief Number of types of relocalisation coefficients
+    static constexpr std::size_t NB_RELOCALISATION_COEFFICIENTS = 3;
+
+    /// @brief Class to store relocalisation coefficients for perforated plates
+    /// @details The coefficients are stored as dense arrays sharing a sorted list of angles. Between two angles, the
+    /// coefficients are linearly interpolated.
+    class RelocalisationFunction {
+        private:
+            /// @brief Build interpolated values for a given type of relocalisation coefficient (a_phi, b_phi or c_phi)
+            /// @param coef_type relocalisation coefficient type
+            /// @param reloc_f1 Plate relocalisation function for the first P/h ratio
+            /// @param reloc_f2 Plate relocalisation function for the second P/h ratio
+            /// @param merged_angles Output list of angles values
+            /// @param ph_ratio \f$ P/h \f$ ratio used to interpolate values
+            /// @return interpolated relolcalisation coefficients a_phi, b_phi or c_phi
+            std::vector<double> build_interpolated_values(RelocalisationCoefficient coef_type,
+                                                          const RelocalisationFunction& reloc_f1,
+                                                          const RelocalisationFunction& reloc_f2,
+                                                          const std::vector<double>& merged_angles,
+                                                          double ph_ratio) const;
+
+            /// @brief Add the coefficients of the angles symmetric to the current ones. The current values are kept
+            /// for the angles which are already defined.
+            /// @param period sum of an angle and its symmetric angle
+            /// @param c_sign factor applied to \f$ c_{\phi} \f$ for the symmetric angles (-1 if anti-symmetric)
+            void add_symmetric_values(double period, double c_sign);
+            /// @brief Set periodic coefficients for angles in [90, 180] based on [0, 90] values
+            void set_periodic_conditions_up();
+            /// @brief Set periodic coefficients for angles in [180, 360] based on [0, 180] values
+            void set_periodic_conditions_down();
+
+            /// @brief Return the type of relocalisation coefficient associated to a key
+            /// @param type key of the relocalisation coefficient: "a_phi", "b_phi" or "c_phi"
+            static RelocalisationCoefficient coefficient_type(const std::string& type);
+            /// @brief Return the rank of the first interval of angles containing an angle
+            /// @param angle given angle (must be in the range of the angles)
+            std::size_t get_interval(double angle) const;
+
+        protected :
+            /// @brief Return the relocalisation coefficient associated to a given angle
+            /// @param angle given angle
+            /// @param type type of relocalisation coefficient "a_phi", "b_phi" or "c_phi"
+            /// @return Value of relocalisation coefficient
+            double get_relocalization_coef(const double& angle, const std::string& type) const;
+
+            /// @brief Sorted list of angles
+            std::vector<double> _angles_;
+            /// @brief Values of relocalisation coefficients for each angle (by rank of RelocalisationCoefficient)
+            std::array<std::vector<double>, NB_RELOCALISATION_COEFFICIENTS> _values_;
+            /// @brief type of lattice
+            std::string _type_ = "";
+
+        public:
+
+            RelocalisationFunction() = default;
+            RelocalisationFunction(const PlateCoefficients& plate_coef);
+            virtual ~RelocalisationFunction() = default;
+
+            /// @brief Get the type of relocalisation coefficients
+            std::string get_type() const { return _type_; }
+            /// @brief Set the type of relocalisation coefficients
+            /// @param a_type type of relocalisation coefficients
+            void set_type(const std::string& a_type) { _type_ = a_type; }
+            /// @brief Get the number of relocalisation coefficients stored in the object
+            /// @return number of relocalisation coefficients
+            std::size_t size() const { return _angles_.empty() ? 0 : NB_RELOCALISATION_COEFFICIENTS; }
+            /// @brief Get the list of angles for which relocalisation coefficients are stored
+            /// @return list of angles
+            const std::vector<double>& get_angles() const { return _angles_; }
+
+            /// @brief Build Relocalisation function for two given plate coefficients. The type of the function must be
+            /// set before (it is used to complete the coefficients of each plate coefficient by periodicity).
+            /// @param ph Expected \f$ P/h \f$ ratio
+            /// @param coef1 first plate coefficients
+            /// @param coef2 second plate coefficients
+            void build_relocalisation_function(const double &ph, const PlateCoefficients &coef1, const PlateCoefficients &coef2);
+
+            /// @brief Set the values of \f$ a_{\phi} \f$, \f$ b_{\phi} \f$ and \f$ c_{\phi} \f$ for several angles
+            /// @param angles sorted list of angles
+            /// @param a_phi values of \f$ a_{\phi} \f$
+            /// @param b_phi values of \f$ b_{\phi} \f$
+            /// @param c_phi values of \f$ c_{\phi} \f$
+            void set_coefficients(std::vector<double> angles, std::vector<double> a_phi,
+                                  std::vector<double> b_phi, std::vector<double> c_phi);
+
+            /// @brief Get value of \f$ a_{\phi} \f$ for a angle
+            /// @param angle given angle
+            /// @return Value of \f$ a_{\phi}
+            double get_a_phi(const double& angle) const { return get_coef(RelocalisationCoefficient::A_PHI, angle); }
+            /// @brief Get value of \f$ b_{\phi} \f$ for a angle
+            /// @param angle given angle
+            /// @return Value of \f$ b_{\phi}
+            double get_b_phi(const double& angle) const { return get_coef(RelocalisationCoefficient::B_PHI, angle); }
+            /// @brief Get value of \f$ c_{\phi} \f$ for a angle
+            /// @param angle given angle
+            /// @return Value of \f$ c_{\phi}
+            double get_c_phi(const double& angle) const { return get_coef(RelocalisationCoefficient::C_PHI, angle); }
+            /// @brief Get value of relocalisation coefficient a for a given angle
+            /// @param type type of relocalisation coefficient: "a_phi", "b_phi" or "c_phi"
+            /// @param angle given angle
+            /// @return Value of relocalisation coefficient
+            double get_coef(const std::string& type, const double& angle) const;
+            /// @brief Get value of relocalisation coefficient for a given angle
+            /// @param type type of relocalisation coefficient
+            /// @param angle given angle
+            /// @return Value of relocalisation coefficient
+            double get_coef(RelocalisationCoefficient type, double angle) const;
+            /// @brief Get value of relocalisation coefficient for an angle of the function
+            /// @param type type of relocalisation coefficient
+            /// @param rank rank of the angle in the list of angles
+            /// @return Value of relocalisation coefficient
+            double get_coef_by_rank(RelocalisationCoefficient type, std::size_t rank) const {
+                return _values_[static_cast<std::size_t>(type)][rank];
+            }
+            /// @brief Get the values of a relocalisation coefficient for all the angles of the function
+            /// @param type type of relocalisation coefficient
+            /// @return values of the coefficient (same size as the list of angles)
+            const std::vector<double>& get_values(RelocalisationCoefficient type) const {
+                return _values_[static_cast<std::size_t>(type)];
+            }
+
+            /// @brief Build the relocalisation function restricted to a list of angles (for instance the angles of a
+            /// plate analysis), so that the coefficients of each angle are read by rank
+            /// @param angles sorted list of angles in the range of the function
+            /// @return relocalisation function defined on the given angles
+            RelocalisationFunction sample(const std::vector<double>& angles) const;
+
+            /// @brief Clone the current object
+            /// @return shared pointer to the cloned object
+            std::shared_ptr<RelocalisationFunction> clone() const;
+            /// @brief Set periodic coefficients if necesssary
+            void set_periodic_conditions();
+    };
+}
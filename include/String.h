@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define STRING_DELIMITER " \t\r\n"
+#define COMMENT_DELIMITER "#;"
+#define QUOTATION_DELIMITER "'\""
+
+/// @brief String manipulation utilities
+/// @namespace str
+/// This namespace provides a collection of string manipulation functions
+/// for common operations such as trimming whitespace, and case conversion.
+namespace str {
+
+    /// @brief value used to represent an unset precision for double conversion to string
+    const double UNSET_STRING_PRECISION = 20;
+
+    /// @brief Remove leading and trailing spaces from a string
+    /// @param str the string to trim
+    /// @return the trimmed string
+    std::string trim(const std::string& str);
+    /// @brief Return a lowercase version of a string
+    /// @param str the original string
+    /// @return the lowercase string
+    std::string lowercase(const std::string& str);
+    /// @brief Return a uppercase version of a string
+    /// @param str the original string
+    /// @return the uppercase string
+    std::string uppercase(const std::string& str);
+    /// @brief Split a string into a vector of strings
+    /// @param str the string to split
+    /// @param delimiter the character to split the string on
+    /// @return a vector of strings
+    std::vector<std::string> split(const std::string& str);
+    /// @brief Split a string into words given as views on the string (no allocation except for the growth of the
+    /// output vector). Words are separated by spaces. A word starting with a quotation mark extends to the next 
+    /// quotation mark and may contain spaces. Leading and trailing quotation marks are removed from each word.
+    /// @param str the string to split
+    /// @param[out] words vector where the words are appended
+    void split_views(std::string_view str, std::vector<std::string_view>& words);
+    /// @brief Replace occurrences of a substring in a string
+    /// @param str the string to search
+    /// @param from the substring to search for
+    /// @param to the substring to replace with
+    /// @param n the maximum number of replacements to make (0 for all)
+    /// @return the modified string
+    std::string replace(const std::string& str, const std::string& from, const std::string& to, std::size_t n = 0);
+
+    /// @brief Read the number written at the start of a word, with the rules of `std::strtod` and `std::strtoull` 
+    /// for decimal notation: an optional sign, digits and, for real numbers, a fractional part and an exponent. 
+    /// Fortran exponents (`1.D3`, `2.5d-1`) are also read for real numbers. A minus sign is accepted for unsigned 
+    /// integers (the value is wrapped as for `std::stoull`).
+    /// @tparam T numeric type (int, std::size_t or double)
+    /// @param word the word to read
+    /// @param[out] value number read (unchanged if no number is read)
+    /// @return number of characters read (0 if the word does not start with a number or if it is out of range)
+    template<typename T>
+    std::size_t parse_number(std::string_view word, T& value);
+    /// @brief Convert a whole word into a number, with the rules of the stream extraction (`>>` operator): the word 
+    /// must start with a digit (or a point for real numbers) after an optional sign and must be entirely read. 
+    /// Fortran exponents are accepted for real numbers (see `parse_number`).
+    /// @tparam T numeric type (int, std::size_t or double)
+    /// @param word the word to convert
+    /// @param[out] value converted number
+    /// @return status of the conversion
+    template<typename T>
+    bool to_number(std::string_view word, T& value);
+
+    /// @brief Convert a double to a string with a specified precision
+    /// @param value double value to convert
+    /// @param precision precision of the conversion
+    /// @return string representation of the double
+    std::string to_string(const double value, const std::size_t precision = UNSET_STRING_PRECISION);
+
+    /// @brief Convert a double to a string with a specified precision in scientific format
+    /// @param value double value to convert
+    /// @param precision precision of the conversion
+    /// @return string representation of the double
+    std::string to_string_exp(const double value, const std::size_t precision = UNSET_STRING_PRECISION);
+
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace abase {
+
+    /// @class ThreadPool
+    /// @brief Pool of worker threads used to execute batches of independent tasks.
+    /// @details Each worker owns a task queue. A batch given to `run` is dealt round-robin to the queues in the
+    /// order of the batch, so that a batch sorted by decreasing cost gives the largest tasks first to each worker.
+    /// A worker takes its own tasks from the front of its queue (largest first) and, when its queue is empty,
+    /// steals the smallest remaining task at the back of another queue to balance the tail of the batch.
+    class ThreadPool {
+        private:
+            /// @brief Task queue owned by a worker
+            struct WorkerQueue {
+                std::deque<std::function<void()>> tasks;
+                std::mutex mutex;
+            };
+
+            /// @brief worker threads
+            std::vector<std::thread> workers;
+            /// @brief task queues (one by worker)
+            std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+            /// @brief Mutex protecting the batch status
+            std::mutex batch_mutex;
+            /// @brief Condition used to wake up the workers when tasks are available
+            std::condition_variable batch_cv;
+            /// @brief Condition used to notify the end of a batch
+            std::condition_variable done_cv;
+            /// @brief Mutex used to execute only one batch at a time
+            std::mutex run_mutex;
+
+            /// @brief number of tasks queued and not yet taken by a worker
+            std::atomic<std::size_t> queued{0};
+            /// @brief number of tasks of the current batch not yet completed
+            std::size_t pending = 0;
+            /// @brief stop request for the workers
+            bool stopping = false;
+            /// @brief first exception raised by a task of the current batch
+            std::exception_ptr first_error = nullptr;
+
+            /// @brief Main loop of a worker
+            /// @param worker worker rank
+            void worker_loop(std::size_t worker);
+            /// @brief Take the next task from the worker's own queue
+            /// @param worker worker rank
+            /// @param[out] task task to execute
+            /// @return true if a task has been found
+            bool pop_local(std::size_t worker, std::function<void()>& task);
+            /// @brief Steal a task from the queue of another worker
+            /// @param worker rank of the thief
+            /// @param[out] task task to execute
+            /// @return true if a task has been found
+            bool steal(std::size_t worker, std::function<void()>& task);
+            /// @brief Execute a task and update the batch status
+            /// @param task task to execute
+            void execute(std::function<void()>& task);
+
+            /// @brief Start the workers
+            /// @param nb_threads number of workers
+            void start(std::size_t nb_threads);
+            /// @brief Stop and join the workers
+            void stop();
+
+        public:
+            /// @brief Constructor by default: no worker, tasks are executed by the calling thread.
+            ThreadPool() = default;
+            /// @brief Destructor (join the workers)
+            ~ThreadPool();
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            /// @brief Set the number of workers. With less than 2 threads, tasks are executed by the calling thread.
+            /// @param nb_threads number of workers
+            void resize(std::size_t nb_threads);
+            /// @brief Return the number of threads used to execute a batch
+            std::size_t size() const { return workers.size() > 0 ? workers.size() : 1; }
+
+            /// @brief Execute a batch of tasks and wait for its completion. The first exception raised by a task is
+            /// rethrown once the batch is completed. A batch run from a task of the same pool is executed sequentially
+            /// by the calling worker. A batch run from a task of another pool is executed by this pool (nested 
+            /// parallelism).
+            /// @param tasks tasks to execute, ideally sorted by decreasing cost
+            void run(std::vector<std::function<void()>>& tasks);
+
+            /// @brief Return true if the calling thread is a worker of a pool
+            static bool in_worker();
+            /// @brief Return the rank of the calling worker in its pool (0 outside of a pool)
+            static std::size_t worker_rank();
+    };
+
+    /// @brief Return the number of threads requested for the computation (`--multi` option, 1 by default)
+    std::size_t requested_nb_threads();
+
+    /// @brief Global instance of ThreadPool.
+    extern ThreadPool globalThreadPool;
+
+} // namespace abase
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace atest {
+
+    /// @brief Number of failed checks of the test program
+    inline std::size_t failures = 0;
+
+    /// @brief Check a condition and report it if it is not satisfied
+    /// @param condition condition to check
+    /// @param message description of the check
+    inline void check(bool condition, const std::string& message) {
+        if (condition) return;
+        ++failures;
+        std::cerr << "FAILED: " << message << std::endl;
+    }
+
+    /// @brief Return the exit status of the test program (number of failed checks reported on the error output)
+    inline int status() {
+        if (failures > 0) std::cerr << failures << " failed check(s)" << std::endl;
+        return failures == 0 ? 0 : 1;
+    }
+
+}
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "RangeList.h"
+#include "TestCheck.h"
+
+namespace {
+
+    /// @brief Check a list against the expected values (iteration, access by rank, size and maximum)
+    void compare(const abase::RangeList& list, const std::vector<std::size_t>& expected, const std::string& label) {
+        atest::check(list.size() == expected.size(), label + ": size");
+        atest::check(list.to_vector() == expected, label + ": values");
+        std::size_t max_value = 0;
+        for (std::size_t rank = 0; rank < expected.size() && rank < list.size(); ++rank) {
+            atest::check(list[rank] == expected[rank], label + ": value of rank " + std::to_string(rank));
+            max_value = std::max(max_value, expected[rank]);
+        }
+        atest::check(list.max() == max_value, label + ": maximum");
+        for (const auto& run : list.get_runs()) atest::check(run.first <= run.last, label + ": decreasing run");
+    }
+
+    /// @brief Return the values shifted one by one (wrap-around of unsigned integers)
+    std::vector<std::size_t> shifted(std::vector<std::size_t> values, std::ptrdiff_t offset) {
+        for (auto& v : values) v += static_cast<std::size_t>(offset);
+        return values;
+    }
+
+}
+
+int main() {
+    constexpr std::size_t MAX = std::numeric_limits<std::size_t>::max();
+
+    // 1-based ranks converted to 0-based ranks, with a rank 0 in the input (wraps around)
+    abase::RangeList list;
+    list.add_range(0, 5, 1);
+    list.shift(-1);
+    compare(list, {MAX, 0, 1, 2, 3, 4}, "run starting at 0");
+
+    list.clear();
+    list.add_range(0, 9, 3);
+    list.add_range(20, 30, 5);
+    list.shift(-4);
+    compare(list, {MAX - 3, MAX, 2, 5, 16, 21, 26}, "runs with steps");
+
+    list.clear();
+    list.add_range(MAX - 4, MAX, 2);
+    list.shift(3);
+    compare(list, {MAX - 1, 0, 2}, "positive wrap-around");
+
+    // random lists against the shifted vectors
+    std::mt19937 generator(35);
+    std::uniform_int_distribution<std::size_t> value(0, 40), step(1, 4), nb_runs(1, 5);
+    std::uniform_int_distribution<std::ptrdiff_t> offset(-20, 20);
+    for (std::size_t trial = 0; trial < 500; ++trial) {
+        abase::RangeList random_list;
+        std::vector<std::size_t> values;
+        for (std::size_t r = nb_runs(generator); r > 0; --r) {
+            std::size_t first = value(generator), bound = first + value(generator), s = step(generator);
+            random_list.add_range(first, bound, s);
+            for (std::size_t v = first; v <= bound; v += s) values.push_back(v);
+        }
+        std::ptrdiff_t d = offset(generator);
+        random_list.shift(d);
+        compare(random_list, shifted(values, d), "random list shifted by " + std::to_string(d));
+    }
+
+    return atest::status();
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "FatigueLaw.h"
+#include "TestCheck.h"
+
+using namespace adata::parts;
+
+namespace {
+
+    /// @brief Power fatigue law with given parameters
+    struct PowerLaw : PowerFatigueLaw {
+        PowerLaw(double alpha, double beta, double Seq, double N_ratio) {
+            this->alpha = alpha;
+            this->beta = beta;
+            this->Seq = Seq;
+            this->N_ratio = N_ratio;
+        }
+    };
+
+    /// @brief Tabular fatigue law with a given table
+    struct TabularLaw : TabularFatigueLaw {
+        TabularLaw(const amath::Table& table, double N_ratio) {
+            this->table = table;
+            this->N_ratio = N_ratio;
+            compile();
+        }
+    };
+
+    /// @brief Polynomial fatigue law with given coefficients
+    struct PolynomialLaw : PolynomialFatigueLaw {
+        PolynomialLaw(const std::vector<double>& coefficients, double Seq, double N_ratio) {
+            this->coefficients = coefficients;
+            this->Seq = Seq;
+            this->N_ratio = N_ratio;
+            compile();
+        }
+    };
+
+    /// @brief Return random stresses of a range
+    std::vector<double> random_stresses(std::mt19937& generator, double Sa_min, double Sa_max) {
+        std::uniform_real_distribution<double> uniform(Sa_min, Sa_max);
+        std::vector<double> Sa(20000);
+        for (auto& s : Sa) s = uniform(generator);
+        return Sa;
+    }
+
+    /// @brief Return numbers of cycles spread over several decades
+    std::vector<std::size_t> random_cycles(std::mt19937& generator, double Na_min, double Na_max) {
+        std::uniform_real_distribution<double> uniform(std::log(Na_min), std::log(Na_max));
+        std::vector<std::size_t> Na(20000);
+        for (auto& n : Na) n = static_cast<std::size_t>(std::exp(uniform(generator)));
+        return Na;
+    }
+
+    /// @brief Check that the batch evaluations of a law give the values of the single evaluations
+    void compare_identical(const FatigueLaw& law, const std::vector<double>& Sa, const std::vector<std::size_t>& Na,
+                           const std::string& label) {
+        std::vector<std::size_t> cycles;
+        atest::check(law.allowable_cycles(Sa, cycles) == 0, "stresses above the curve: " + label);
+        for (std::size_t k = 0; k < Sa.size(); ++k) {
+            atest::check(cycles[k] == law.allowable_cycles(Sa[k]),
+                         "batch cycles differ for Sa = " + std::to_string(Sa[k]) + ": " + label);
+        }
+        std::vector<double> stresses;
+        atest::check(law.allowable_stress(Na, stresses) == 0, "cycles below the curve: " + label);
+        for (std::size_t k = 0; k < Na.size(); ++k) {
+            atest::check(stresses[k] == law.allowable_stress(Na[k]),
+                         "batch stress differs for Na = " + std::to_string(Na[k]) + ": " + label);
+        }
+    }
+}
+
+// Batch evaluations of the fatigue laws against the single evaluations: identical values for the tabular and
+// polynomial laws, relative difference lower than 1e-13 before truncation for the power law. Undefined stresses and
+// numbers of cycles out of the integer range are checked too.
+int main() {
+    std::mt19937 generator(50);
+
+    // power law: the numbers of cycles may differ by one when the truncation falls between the two values
+    PowerLaw power(2.233e15, 4.995, 74.4, 2.);
+    std::vector<double> Sa = random_stresses(generator, 80., 2000.);
+    std::vector<std::size_t> cycles;
+    atest::check(power.allowable_cycles(Sa, cycles) == 0, "power law stresses above the curve");
+    for (std::size_t k = 0; k < Sa.size(); ++k) {
+        double single = static_cast<double>(power.allowable_cycles(Sa[k]));
+        double batch = static_cast<double>(cycles[k]);
+        atest::check(std::abs(batch - single) <= 1. + 1e-13 * single,
+                     "power law batch cycles differ for Sa = " + std::to_string(Sa[k]));
+    }
+    std::vector<std::size_t> Na = random_cycles(generator, 1., 1e11);
+    std::vector<double> stresses;
+    atest::check(power.allowable_stress(Na, stresses) == 0, "power law cycles below the curve");
+    for (std::size_t k = 0; k < Na.size(); ++k) {
+        double single = power.allowable_stress(Na[k]);
+        atest::check(std::abs(stresses[k] - single) <= 1e-13 * single,
+                     "power law batch stress differs for Na = " + std::to_string(Na[k]));
+    }
+
+    // tabular law: log-log interpolation of the table
+    amath::Table table({10., 20., 50., 100., 200., 500., 1e3, 1e4, 1e5, 1e6, 1e11},
+                       {4000., 2830., 1900., 1410., 1070., 725., 570., 280., 172., 110., 94.});
+    TabularLaw tabular(table, 2.);
+    compare_identical(tabular, random_stresses(generator, 94., 4000.), random_cycles(generator, 6., 5e10), "tabular");
+
+    // polynomial law: compiled curve of the polynomial
+    PolynomialLaw polynomial({400., -3e-3, 1e-8}, 170., 1.);
+    compare_identical(polynomial, random_stresses(generator, 170., 399.), random_cycles(generator, 1., 1e5),
+                      "polynomial");
+
+    // undefined stresses: 1 allowable cycle, not counted above the curve; huge numbers of cycles: saturation
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> undefined = {nan, 100., nan};
+    for (const FatigueLaw* law : std::vector<const FatigueLaw*>{&power, &tabular, &polynomial}) {
+        atest::check(law->allowable_cycles(undefined, cycles) == 0, "undefined stress above the curve: " + law->get_type());
+        atest::check(cycles[0] == 1 && cycles[2] == 1, "undefined stress not on 1 cycle: " + law->get_type());
+    }
+    atest::check(power.allowable_cycles(nan) == 1, "power law undefined stress not on 1 cycle");
+    atest::check(polynomial.allowable_cycles(nan) == 1, "polynomial law undefined stress not on 1 cycle");
+    atest::check(power.allowable_cycles(1e-10) == std::numeric_limits<std::size_t>::max(), "power law not saturated");
+    atest::check(power.allowable_cycles({1e-10}, cycles) == 0 && cycles[0] == std::numeric_limits<std::size_t>::max(),
+                 "power law batch not saturated");
+    return atest::status();
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Coefficient.h"
+#include "CompiledTable.h"
+#include "Table.h"
+#include "TestCheck.h"
+
+namespace {
+
+    /// @brief Return true if the interpolation of a table throws for an abciss value
+    bool throws(const amath::CompiledTable& table, double x) {
+        try {
+            table.get_yvalue(x);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Return a sorted vector of random values, with the bounds of the range included
+    std::vector<double> sorted_values(std::mt19937& generator, std::size_t size, double vmin, double vmax, bool decreasing) {
+        std::uniform_real_distribution<double> uniform(vmin, vmax);
+        std::vector<double> values(size);
+        for (auto& v : values) v = uniform(generator);
+        values.front() = vmin;
+        values.back() = vmax;
+        std::sort(values.begin(), values.end());
+        if (decreasing) std::reverse(values.begin(), values.end());
+        return values;
+    }
+
+    /// @brief Compare a compiled table (direct and inverse) with the original table
+    void compare(std::mt19937& generator, const amath::Table& table, const std::string& method, const std::string& label) {
+        amath::CompiledTable compiled(table, method);
+        amath::CompiledTable inverse = amath::CompiledTable::inverse(table, method);
+        const std::vector<double> xknots = table.get_xvalues();
+        const std::vector<double> yknots = table.get_yvalues();
+
+        // knots and random values of the range
+        std::vector<double> x = xknots;
+        std::vector<double> y = yknots;
+        std::uniform_real_distribution<double> xuniform(table.get_xmin(), table.get_xmax());
+        std::uniform_real_distribution<double> yuniform(table.get_ymin(), table.get_ymax());
+        for (std::size_t k = 0; k < 500; ++k) {
+            x.push_back(xuniform(generator));
+            y.push_back(yuniform(generator));
+        }
+
+        std::vector<double> batch;
+        compiled.get_yvalues(x, batch);
+        for (std::size_t k = 0; k < x.size(); ++k) {
+            double expected = table.get_yvalue(x[k], method);
+            atest::check(compiled.get_yvalue(x[k]) == expected, "ordinate differs from the table: " + label);
+            atest::check(batch[k] == expected, "batch ordinate differs from the table: " + label);
+        }
+        inverse.get_yvalues(y, batch);
+        for (std::size_t k = 0; k < y.size(); ++k) {
+            double expected = table.get_xvalue(y[k], method);
+            atest::check(inverse.get_yvalue(y[k]) == expected, "abciss differs from the table: " + label);
+            atest::check(batch[k] == expected, "batch abciss differs from the table: " + label);
+        }
+
+        // outside the range: exception for a single value, NaN for the batch
+        const double infinity = std::numeric_limits<double>::infinity();
+        std::vector<double> outside = {std::nextafter(table.get_xmin(), -infinity),
+                                       std::nextafter(table.get_xmax(), infinity),
+                                       std::numeric_limits<double>::quiet_NaN()};
+        compiled.get_yvalues(outside, batch);
+        for (std::size_t k = 0; k < outside.size(); ++k) {
+            atest::check(throws(compiled, outside[k]), "no exception outside the table: " + label);
+            atest::check(std::isnan(batch[k]), "batch ordinate defined outside the table: " + label);
+        }
+    }
+}
+
+// CompiledTable against the interpolations of Table: the values must be identical, not only close.
+int main() {
+    std::mt19937 generator(47);
+
+    for (std::size_t size : {2, 3, 10, 100}) {
+        for (bool decreasing_x : {false, true}) {
+            for (bool decreasing_y : {false, true}) {
+                std::string label = std::to_string(size) + (decreasing_x ? " decreasing" : " increasing") +
+                                    (decreasing_y ? " decreasing" : " increasing");
+                // linear interpolation: values of both signs
+                amath::Table linear(sorted_values(generator, size, -50., 300., decreasing_x),
+                                    sorted_values(generator, size, -10., 10., decreasing_y));
+                compare(generator, linear, "linear", "linear " + label);
+                // logarithmic interpolation: positive values over several decades
+                amath::Table logarithmic(sorted_values(generator, size, 10., 1e6, decreasing_x),
+                                         sorted_values(generator, size, 1e-2, 1e3, decreasing_y));
+                compare(generator, logarithmic, "logarithmic", "logarithmic " + label);
+            }
+        }
+    }
+
+    // abciss values not sorted: the compiled table uses the original table
+    amath::Table unsorted({0., 2., 1., 3.}, {1., 2., 3., 4.});
+    amath::CompiledTable compiled(unsorted, "linear");
+    std::uniform_real_distribution<double> uniform(0., 3.);
+    for (std::size_t k = 0; k < 100; ++k) {
+        double x = uniform(generator);
+        atest::check(compiled.get_yvalue(x) == unsorted.get_yvalue(x, "linear"), "unsorted ordinate differs");
+    }
+
+    // coefficients: table compiled once with the interpolation of the coefficient, recompiled on conversion
+    amath::Table curve({20., 100., 200., 350.}, {200000., 195000., 186000., 175000.});
+    amath::LinearCoefficient linear(curve);
+    amath::LogarithmicCoefficient logarithmic(linear);
+    amath::LinearCoefficient copy;
+    copy = linear;
+    std::vector<double> temperatures = {20., 50., 150., 349.}, yl, ylog, ycopy;
+    linear.get_yvalues(temperatures, yl);
+    logarithmic.get_yvalues(temperatures, ylog);
+    copy.get_yvalues(temperatures, ycopy);
+    for (std::size_t k = 0; k < temperatures.size(); ++k) {
+        atest::check(yl[k] == curve.get_yvalue(temperatures[k], "linear"), "linear coefficient differs");
+        atest::check(ylog[k] == curve.get_yvalue(temperatures[k], "logarithmic"), "logarithmic coefficient differs");
+        atest::check(ycopy[k] == yl[k], "copied coefficient differs");
+    }
+    return atest::status();
+}
@@ -0,0 +1,99 @@
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "NeuberSolver.h"
+#include "TestCheck.h"
+
+namespace {
+
+    /// @brief Reference scalar solution of the Neuber rule: bisection of x eps(x) = S^2 / E on [0, S]
+    double neuber_reference(const amath::CyclicCurve& curve, double S) {
+        if (S == 0.) return 0.;
+        double target = S * S / curve.E;
+        double lower = 0., upper = S;
+        for (std::size_t it = 0; it < 200 && upper - lower > 0.; ++it) {
+            double x = 0.5 * (lower + upper);
+            if (x == lower || x == upper) break;
+            if (x * curve.strain(x) < target) lower = x; else upper = x;
+        }
+        return 0.5 * (lower + upper);
+    }
+
+    /// @brief Check a batch solution against the reference solution
+    void compare(const amath::CyclicCurve& curve, const std::vector<double>& elastic, std::size_t nb_columns,
+                 const std::string& label) {
+        amath::NeuberSolver solver(curve);
+        amath::NeuberResults results;
+        solver.solve(elastic, nb_columns, results);
+        atest::check(results.stress.size() == elastic.size(), label + ": size of the results");
+        atest::check(results.statistics.not_converged == 0, label + ": ranges not converged");
+        atest::check(results.statistics.undefined == 0, label + ": undefined ranges");
+        for (std::size_t k = 0; k < elastic.size(); ++k) {
+            double reference = neuber_reference(curve, elastic[k]);
+            double stress = results.stress[k];
+            atest::check(std::abs(stress - reference) <= 1e-9 * reference,
+                         label + ": stress differs from the reference for S = " + std::to_string(elastic[k]));
+            atest::check(stress <= elastic[k], label + ": stress out of the bracket");
+            double strain = stress > 0. ? curve.strain(stress) : 0.;
+            atest::check(results.strain[k] == strain, label + ": strain differs from the cyclic curve");
+        }
+    }
+
+}
+
+int main() {
+    std::mt19937 generator(49);
+
+    // curves with small and large hardening exponents
+    std::vector<amath::CyclicCurve> curves = {{200000., 1200., 0.15}, {190000., 900., 0.05}, {210000., 2000., 0.5}};
+    for (const auto& curve : curves) {
+        std::string label = "n = " + std::to_string(curve.n);
+
+        // single column: every range starts from the closed-form guess
+        std::vector<double> column = {1e-3, 1., 10., 100., 300., 600., 1000., 3000., 1e4, 1e5};
+        compare(curve, column, 1, label + " closed form");
+
+        // rows of increasing, decreasing and random ranges: warm starts from the previous column
+        std::uniform_real_distribution<double> uniform(0., 5000.);
+        std::size_t nb_rows = 7, nb_columns = 9;
+        std::vector<double> matrix(nb_rows * nb_columns);
+        for (std::size_t row = 0; row < nb_rows; ++row) {
+            for (std::size_t col = 0; col < nb_columns; ++col) {
+                double& S = matrix[row * nb_columns + col];
+                if (row == 0) S = 100. * (col + 1);
+                else if (row == 1) S = 100. * (nb_columns - col);
+                else S = uniform(generator);
+            }
+        }
+        compare(curve, matrix, nb_columns, label + " warm start");
+
+        // bracket end points: null range, and ranges for which the solution is the elastic range
+        amath::NeuberSolver solver(curve);
+        atest::check(solver.solve(0.) == 0., label + ": null range");
+        double tiny = 1e-12;
+        atest::check(std::abs(solver.solve(tiny) - tiny) <= 1e-9 * tiny, label + ": elastic solution");
+    }
+
+    // undefined elastic ranges: NaN results, counted, without effect on the other ranges
+    amath::CyclicCurve curve = curves.front();
+    amath::NeuberSolver solver(curve);
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> elastic = {500., nan, 700., -10., 0., 900.};
+    amath::NeuberResults results;
+    solver.solve(elastic, 3, results);
+    atest::check(results.statistics.undefined == 2, "undefined ranges not counted");
+    atest::check(std::isnan(results.stress[1]) && std::isnan(results.strain[1]), "NaN range gives a defined result");
+    atest::check(std::isnan(results.stress[3]) && std::isnan(results.strain[3]), "negative range gives a defined result");
+    atest::check(results.stress[4] == 0. && results.strain[4] == 0., "null range gives a non null result");
+    for (std::size_t k : {0, 2, 5}) {
+        double reference = neuber_reference(curve, elastic[k]);
+        atest::check(std::abs(results.stress[k] - reference) <= 1e-9 * reference,
+                     "range next to an undefined range differs from the reference");
+    }
+    atest::check(std::isnan(solver.solve(nan)), "scalar solve of a NaN range");
+
+    return atest::status();
+}
@@ -0,0 +1,63 @@
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "PlateAngleSearch.h"
+#include "TestCheck.h"
+
+// Refine mode against the dense sweep over random relocalised stresses, including near-hydrostatic tensors whose
+// Tresca stresses have the largest rounding errors.
+int main() {
+    std::mt19937 generator(45);
+    std::normal_distribution<double> normal(0., 100.);
+    std::uniform_real_distribution<double> uniform(-1., 1.);
+
+    // piecewise-linear coefficients on 15° knots
+    std::vector<double> knots, a, b, c;
+    for (double angle = 0.; angle <= 360.; angle += 15.) {
+        knots.push_back(angle);
+        a.push_back(uniform(generator));
+        b.push_back(uniform(generator));
+        c.push_back(uniform(generator));
+    }
+
+    std::size_t nb_cases = 0;
+    for (double step : {1., 2.5, 7.}) {
+        std::vector<double> grid;
+        for (double angle = 0.; angle <= 360.; angle += step) grid.push_back(angle);
+
+        for (const std::string method : {"tresca", "mises", "reduced_mises"}) {
+            amath::PlateAngleSearch search(knots, a, b, c, grid, method);
+
+            for (std::size_t k = 0; k < 2000; ++k) {
+                amath::RelocalisedStress stress;
+                // scale of the angle-dependent part: from comparable to the constant part down to 1e-9 of it
+                double scale = std::pow(10., -9. * static_cast<double>(k % 4) / 3.);
+                for (std::size_t i = 0; i < amath::STRESS_SIZE; ++i) {
+                    stress.a[i] = normal(generator) * scale;
+                    stress.b[i] = normal(generator) * scale;
+                    stress.c[i] = normal(generator) * scale;
+                    stress.d[i] = normal(generator) * scale;
+                }
+                // large hydrostatic part
+                if (k % 2 == 0) {
+                    double pressure = normal(generator) * 10.;
+                    for (std::size_t i = 0; i < 3; ++i) stress.d[i] += pressure;
+                }
+
+                amath::AngleExtreme sweep = search.maximise(stress, amath::AngleSearchMode::sweep);
+                amath::AngleExtreme refine = search.maximise(stress, amath::AngleSearchMode::refine);
+                if (std::isnan(sweep.value) || std::isnan(refine.value)) continue;
+                ++nb_cases;
+
+                std::string label = method + " step " + std::to_string(step) + " case " + std::to_string(k);
+                atest::check(refine.value == sweep.value, "refined maximum differs from the sweep: " + label);
+                atest::check(refine.rank == sweep.rank, "refined angle differs from the sweep: " + label);
+                atest::check(refine.nb_evaluations <= grid.size() + 4, "too many evaluations: " + label);
+            }
+        }
+    }
+    atest::check(nb_cases > 10000, "too few cases checked");
+    return atest::status();
+}
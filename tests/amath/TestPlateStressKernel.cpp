@@ -0,0 +1,90 @@
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "PlateStressKernel.h"
+#include "TestCheck.h"
+
+namespace {
+
+    /// @brief Return true if two values have the same bits
+    bool same_bits(double x, double y) { return std::memcmp(&x, &y, sizeof(double)) == 0; }
+
+    /// @brief Return the equivalent stress of a tensor
+    double equivalent(const amath::Stress& stress, const std::string& method) {
+        if (method == "mises") return stress.mises();
+        if (method == "reduced_mises") return stress.reduced_mises();
+        return stress.tresca();
+    }
+
+}
+
+// Kernel results against the per-angle scalar evaluation, bit for bit, with angles sharing a group of coefficients
+// (same (a, b, |c|), with either sign of c and signed zeros).
+int main() {
+    std::mt19937 generator(46);
+    std::normal_distribution<double> normal(0., 100.);
+    std::uniform_real_distribution<double> uniform(-1., 1.);
+
+    // coefficients of the angles: distinct triples, then copies and sign changes of c sharing their groups
+    std::vector<double> a, b, c;
+    for (std::size_t k = 0; k < 24; ++k) {
+        a.push_back(uniform(generator));
+        b.push_back(uniform(generator));
+        c.push_back(k % 6 == 0 ? 0. : uniform(generator));
+    }
+    std::size_t nb_distinct = a.size();
+    for (std::size_t k = 0; k < nb_distinct; ++k) {
+        a.push_back(a[k]);
+        b.push_back(b[k]);
+        c.push_back(-c[k]);
+        if (k % 3 == 0) {
+            a.push_back(a[k]);
+            b.push_back(b[k]);
+            c.push_back(c[k]);
+        }
+    }
+
+    for (const std::string method : {"tresca", "mises", "reduced_mises"}) {
+        amath::PlateStressKernel kernel(a, b, c, method);
+        atest::check(kernel.nb_angles() == a.size(), method + ": number of angles");
+        atest::check(kernel.nb_folded() == 2 * nb_distinct, method + ": angles not grouped");
+
+        for (std::size_t trial = 0; trial < 200; ++trial) {
+            std::vector<amath::RelocalisedStress> stresses(3);
+            for (auto& stress : stresses) {
+                for (std::size_t i = 0; i < amath::STRESS_SIZE; ++i) {
+                    stress.a[i] = normal(generator);
+                    stress.b[i] = normal(generator);
+                    stress.c[i] = trial % 4 == 0 ? 0. : normal(generator);
+                    stress.d[i] = trial % 5 == 0 ? -0. : normal(generator);
+                }
+            }
+
+            std::vector<amath::Stress> tensors;
+            kernel.relocalise(stresses.front(), tensors);
+            std::vector<double> values;
+            kernel.evaluate(stresses, values);
+            atest::check(values.size() == stresses.size() * a.size(), method + ": number of values");
+
+            for (std::size_t s = 0; s < stresses.size(); ++s) {
+                for (std::size_t k = 0; k < a.size(); ++k) {
+                    amath::Stress expected = stresses[s].at(a[k], b[k], c[k]);
+                    if (s == 0) {
+                        bool same = true;
+                        for (std::size_t i = 0; i < amath::STRESS_SIZE; ++i) {
+                            same = same && same_bits(tensors[k][i], expected[i]);
+                        }
+                        atest::check(same, method + ": relocalised stress differs for angle " + std::to_string(k));
+                    }
+                    atest::check(same_bits(values[s * a.size() + k], equivalent(expected, method)),
+                                 method + ": equivalent stress differs for angle " + std::to_string(k));
+                }
+            }
+        }
+    }
+
+    return atest::status();
+}
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "PolynomialCurve.h"
+#include "TestCheck.h"
+
+namespace {
+
+    /// @brief Check the inverses of a curve against its values for random ordinates of its range
+    void compare(std::mt19937& generator, const amath::PolynomialCurve& curve, double xmin, double xmax,
+                 const std::string& label) {
+        // margin on the abciss values: ten times the tolerance of the inversion
+        const double margin = 10. * amath::POLYNOMIAL_INVERSE_TOLERANCE;
+
+        std::uniform_real_distribution<double> uniform(curve.get_ymin(), curve.get_ymax());
+        std::vector<double> y(2000);
+        for (auto& v : y) v = uniform(generator);
+        std::sort(y.begin(), y.end());
+
+        std::vector<double> x;
+        curve.inverse(y, x);
+        for (std::size_t k = 0; k < y.size(); ++k) {
+            std::string case_label = label + " y = " + std::to_string(y[k]);
+            atest::check(x[k] == curve.inverse(y[k]), "batch inverse differs: " + case_label);
+            atest::check(x[k] >= xmin && x[k] <= xmax, "inverse outside the interval: " + case_label);
+            // the curve crosses the ordinate within the tolerance
+            if (x[k] > xmin) atest::check(curve.value(x[k] * (1. - margin)) > y[k], "inverse too high: " + case_label);
+            if (x[k] < xmax) atest::check(curve.value(x[k] * (1. + margin)) <= y[k], "inverse too low: " + case_label);
+            // smallest abciss: the curve stays above the ordinate before the inverse
+            for (double t = xmin; t < x[k] * (1. - margin); t *= 1.01) {
+                if (curve.value(t) <= y[k]) {
+                    atest::check(false, "inverse is not the smallest abciss: " + case_label);
+                    break;
+                }
+            }
+            // non-increasing function of the ordinate
+            if (k > 0) atest::check(x[k] <= x[k - 1], "inverse not monotonic: " + case_label);
+        }
+
+        // ordinates outside the range of the curve
+        atest::check(curve.inverse(curve.get_ymax() * 1.5) == xmin, "inverse above the curve: " + label);
+        atest::check(std::isnan(curve.inverse(curve.get_ymin() - std::abs(curve.get_ymin()) - 1.)),
+                     "inverse below the curve: " + label);
+    }
+}
+
+// PolynomialCurve::inverse against PolynomialCurve::value, for monotonic and non-monotonic polynomials.
+int main() {
+    std::mt19937 generator(50);
+
+    // decreasing fatigue curves on [1, 1e12]
+    std::vector<double> quadratic = {400., -3e-3, 1e-8};
+    compare(generator, amath::PolynomialCurve(quadratic, 1., 1e12), 1., 1e12, "quadratic");
+    std::vector<double> steep = {8.83441, -0.676654, 2.45424e-2};
+    compare(generator, amath::PolynomialCurve(steep, 1., 1e12), 1., 1e12, "steep");
+
+    // 50 - (x - 3)(x - 6)(x - 9): local minimum near 4.27, local maximum near 7.73
+    std::vector<double> cubic = {212., -99., 18., -1.};
+    amath::PolynomialCurve curve(cubic, 1., 12.);
+    compare(generator, curve, 1., 12., "cubic");
+    // ordinate between the local minimum and the local maximum: the crossing before the local minimum
+    atest::check(curve.inverse(45.) < 4.27, "inverse is not the first crossing of the cubic");
+    return atest::status();
+}
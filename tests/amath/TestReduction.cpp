@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Reduction.h"
+#include "TestCheck.h"
+
+int main() {
+    std::mt19937 generator(28);
+
+    // cancellation: the compensated sum keeps the small values
+    atest::check(amath::ordered_sum({1e16, 1., -1e16}) == 1., "compensated sum lost a small value");
+    atest::check(amath::ordered_sum({1., 1e100, 1., -1e100}) == 2., "compensated sum lost the small values");
+    atest::check(amath::ordered_sum({}) == 0., "empty sum is not null");
+
+    // values of very different magnitudes: error of the order of the rounding of the result
+    std::uniform_real_distribution<double> mantissa(-1., 1.);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+    std::vector<double> values(10000);
+    for (auto& v : values) v = std::ldexp(mantissa(generator), exponent(generator));
+    long double reference = 0.;
+    for (double v : values) reference += v;
+    double sum = amath::ordered_sum(values);
+    atest::check(std::abs(sum - static_cast<double>(reference)) <= 4. * std::abs(sum) * 1e-16,
+                 "compensated sum differs from the extended precision sum");
+
+    // partial results written by several threads in any order: same merged result as a sequential filling
+    std::size_t nb_tasks = 257;
+    amath::OrderedReduction<double> sequential(nb_tasks, 0.);
+    for (std::size_t task = 0; task < nb_tasks; ++task) sequential[task] = values[task] * 1e10;
+    for (std::size_t trial = 0; trial < 10; ++trial) {
+        std::vector<std::size_t> order(nb_tasks);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), generator);
+
+        amath::OrderedReduction<double> parallel(nb_tasks, 0.);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t]() {
+                for (std::size_t k = t; k < nb_tasks; k += 4) parallel[order[k]] = values[order[k]] * 1e10;
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        atest::check(amath::ordered_sum(parallel.values()) == amath::ordered_sum(sequential.values()),
+                     "ordered sum depends on the completion order");
+        auto max_merge = [](double& result, double partial) { result = std::max(result, partial); };
+        atest::check(parallel.reduce(-INFINITY, max_merge) == sequential.reduce(-INFINITY, max_merge),
+                     "ordered maximum depends on the completion order");
+    }
+
+    return atest::status();
+}
@@ -0,0 +1,93 @@
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "StressContainer.h"
+#include "StressRecord.h"
+#include "TestCheck.h"
+
+namespace {
+
+    /// @brief Return a stress range with float-representable values (ratios drawn among few values to get ties, the
+    /// first load is the given identifier so that the total order is strict)
+    amath::StressContainer random_range(std::mt19937& generator, std::size_t id) {
+        std::uniform_int_distribution<int> ratio(0, 3);
+        std::uniform_int_distribution<std::size_t> rank(0, 5);
+        amath::StressContainer range;
+        range.set_range({100. + ratio(generator), 0.5 * ratio(generator), 0.25 * ratio(generator)},
+                        {id, rank(generator)}, rank(generator));
+        range.set_combination(rank(generator));
+        range.set_temperatures(20., 300.);
+        return range;
+    }
+
+    /// @brief Return true if both objects store the same state
+    bool same(const amath::StressContainer& a, const amath::StressContainer& b) {
+        auto ra = a.get_range(), rb = b.get_range();
+        return ra.range == rb.range && ra.mean == rb.mean && ra.ratio == rb.ratio && ra.loads == rb.loads &&
+               ra.torsor == rb.torsor && ra.combination == rb.combination;
+    }
+
+}
+
+int main() {
+    std::mt19937 generator(29);
+
+    // the wide state is kept by the compact record (values representable as float)
+    amath::StressContainer range = random_range(generator, 0);
+    atest::check(same(amath::StressContainer(range.compact()), range), "compact record differs from the container");
+
+    // same maximum with both representations, for both selections and several orders of the results
+    for (bool total_order : {false, true}) {
+        for (std::size_t trial = 0; trial < 100; ++trial) {
+            std::vector<amath::StressContainer> ranges;
+            for (std::size_t k = 0; k < 20; ++k) ranges.push_back(random_range(generator, k));
+
+            amath::StressContainer wide = ranges.front();
+            amath::StressRecord record = ranges.front().compact();
+            for (const auto& r : ranges) {
+                wide.store_max(r, total_order);
+                record.store_max(r.compact(), total_order);
+            }
+            atest::check(same(amath::StressContainer(record), wide), "record maximum differs from the container one");
+
+            amath::SparseRecordMatrix forward, backward;
+            for (std::size_t k = 0; k < ranges.size(); ++k) {
+                std::size_t j = ranges.size() - 1 - k;
+                forward.store_max(k % 3, 1, ranges[k].compact(), true);
+                backward.store_max(j % 3, 1, ranges[j].compact(), true);
+            }
+            for (std::size_t row = 0; row < 3; ++row) {
+                const amath::StressRecord* f = forward.find(row, 1);
+                const amath::StressRecord* b = backward.find(row, 1);
+                atest::check(f && b && same(amath::StressContainer(*f), amath::StressContainer(*b)),
+                             "total order maximum depends on the order");
+            }
+        }
+    }
+
+    // ratio-only selection keeps the current maximum for equal ratios
+    amath::StressRecord first, second;
+    first.ratio = second.ratio = 1.f;
+    first.combination = 7;
+    second.combination = 3;
+    amath::StressRecord kept = first;
+    kept.store_max(second);
+    atest::check(kept.combination == 7, "ratio-only selection replaced an equal ratio");
+    kept.store_max(second, true);
+    atest::check(kept.combination == 3, "total order did not select the lowest combination");
+
+    // ranks out of the compact range
+    amath::StressContainer large;
+    large.set_combination(std::size_t(1) << 40);
+    bool thrown = false;
+    try {
+        large.compact();
+    } catch (const std::overflow_error&) {
+        thrown = true;
+    }
+    atest::check(thrown, "combination rank overflow not detected");
+
+    return atest::status();
+}